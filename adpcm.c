@@ -0,0 +1,206 @@
+/* Author: Peter "Projectitis" Vullings <peter@projectitis.com> */
+
+/* This program is free software. It comes without any warranty, to the
+ * extent permitted by applicable law. You can redistribute it and/or
+ * modify it under the terms of the Do What The Fuck You Want To Public
+ * License, Version 2, as published by Sam Hocevar. See
+ * http://sam.zoy.org/wtfpl/COPYING for more details. */
+
+#include "xm_internal.h"
+
+#ifdef XM_ADPCM_SAMPLES
+
+/* Waveforms are stored as 4 bit IMA ADPCM in independent blocks of
+ * XM_ADPCM_BLOCK_SAMPLES samples. A block starts with its first sample
+ * as a 16 bit value and the step index to decode the rest with, followed
+ * by one nibble (low nibble first) for each of the other samples.
+ *
+ * Looped samples start a new block at loop_start, so jumping back to
+ * the start of the loop never has to decode anything before it. */
+
+static const int16_t xm_adpcm_steps[89] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+	50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+	253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+	1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+	3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+	12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+static const int8_t xm_adpcm_index_adjust[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+/* Apply one nibble to the decoder state. The encoder runs the same code
+ * so both stay in step. */
+static inline void xm_adpcm_step(uint8_t nibble, int32_t* predictor, int8_t* index) {
+	int32_t step = xm_adpcm_steps[*index];
+	int32_t diff = step >> 3;
+
+	if(nibble & 4) diff += step;
+	if(nibble & 2) diff += step >> 1;
+	if(nibble & 1) diff += step >> 2;
+	*predictor += (nibble & 8) ? -diff : diff;
+	if(*predictor > 32767) *predictor = 32767;
+	else if(*predictor < -32768) *predictor = -32768;
+
+	*index += xm_adpcm_index_adjust[nibble & 7];
+	if(*index < 0) *index = 0;
+	else if(*index > 88) *index = 88;
+}
+
+uint32_t xm_adpcm_split(const xm_sample_t* sample) {
+	return (sample->loop_type != XM_NO_LOOP && sample->loop_start < sample->length) ? sample->loop_start : 0;
+}
+
+uint32_t xm_adpcm_block_of(const xm_sample_t* sample, uint32_t k, uint32_t* first, uint32_t* count) {
+	uint32_t split = xm_adpcm_split(sample);
+	uint32_t before = (split + XM_ADPCM_BLOCK_SAMPLES - 1) / XM_ADPCM_BLOCK_SAMPLES;
+	uint32_t block, end;
+
+	if(k < split) {
+		block = k / XM_ADPCM_BLOCK_SAMPLES;
+		*first = block * XM_ADPCM_BLOCK_SAMPLES;
+		end = split;
+	} else {
+		block = before + (k - split) / XM_ADPCM_BLOCK_SAMPLES;
+		*first = split + (k - split) / XM_ADPCM_BLOCK_SAMPLES * XM_ADPCM_BLOCK_SAMPLES;
+		end = sample->length;
+	}
+	*count = (end - *first < XM_ADPCM_BLOCK_SAMPLES) ? end - *first : XM_ADPCM_BLOCK_SAMPLES;
+	return block;
+}
+
+uint32_t xm_adpcm_size(const xm_sample_t* sample) {
+	uint32_t first, count;
+
+	if(sample->length == 0) return 0;
+	return (xm_adpcm_block_of(sample, sample->length - 1, &first, &count) + 1) * XM_ADPCM_BLOCK_BYTES;
+}
+
+int16_t xm_adpcm_first(const uint8_t* block) {
+	return (int16_t)(block[0] | (block[1] << 8));
+}
+
+void xm_adpcm_decode_block(const uint8_t* block, int16_t* out) {
+	int32_t predictor = xm_adpcm_first(block);
+	int8_t index = (int8_t)block[2];
+
+	out[0] = (int16_t)predictor;
+	for(uint16_t i = 1; i < XM_ADPCM_BLOCK_SAMPLES; ++i) {
+		uint8_t byte = block[4 + ((i - 1) >> 1)];
+		xm_adpcm_step((i & 1) ? (byte & 0x0F) : (byte >> 4), &predictor, &index);
+		out[i] = (int16_t)predictor;
+	}
+}
+
+#define XM_ADPCM_INPUT(sample, k) \
+	(((sample)->bits == 16) ? (sample)->data16[k] : (int32_t)(sample)->data8[k] * 256)
+
+/* Squared error of coding input with nibble, followed by the best
+ * nibble for next (the one after it) if there is one */
+static int64_t xm_adpcm_cost(uint8_t nibble, int32_t predictor, int8_t index, int32_t input,
+                             const int32_t* next) {
+	int64_t error, best = INT64_MAX;
+
+	xm_adpcm_step(nibble, &predictor, &index);
+	error = (int64_t)(input - predictor) * (input - predictor);
+	if(next == NULL) return error;
+
+	for(uint8_t n = 0; n < 16; ++n) {
+		int32_t p = predictor;
+		int8_t i = index;
+		int64_t e;
+
+		xm_adpcm_step(n, &p, &i);
+		e = (int64_t)(*next - p) * (*next - p);
+		if(e < best) best = e;
+	}
+	return error + best;
+}
+
+/* Encode count (at most XM_ADPCM_BLOCK_SAMPLES) samples starting at
+ * first, starting from the given step index. out may be NULL to only
+ * measure the squared error.
+ *
+ * Without lookahead this is the usual IMA encoder. With it, each nibble
+ * is picked so that the next sample can be reached too, which follows
+ * the sharp edges of chip style waveforms much better. */
+static uint64_t xm_adpcm_encode_block(const xm_sample_t* sample, uint32_t first, uint32_t count,
+                                      int8_t index, bool lookahead, uint8_t* out) {
+	int32_t predictor = XM_ADPCM_INPUT(sample, first);
+	uint64_t error = 0;
+
+	if(out) {
+		memset(out, 0, XM_ADPCM_BLOCK_BYTES);
+		out[0] = (uint8_t)predictor;
+		out[1] = (uint8_t)(predictor >> 8);
+		out[2] = (uint8_t)index;
+	}
+
+	for(uint32_t i = 1; i < count; ++i) {
+		int32_t input = XM_ADPCM_INPUT(sample, first + i);
+		uint8_t nibble = 0;
+
+		if(lookahead) {
+			int32_t next = (i + 1 < count) ? XM_ADPCM_INPUT(sample, first + i + 1) : 0;
+			int64_t best = INT64_MAX;
+
+			for(uint8_t n = 0; n < 16; ++n) {
+				int64_t cost = xm_adpcm_cost(n, predictor, index, input, (i + 1 < count) ? &next : NULL);
+				if(cost < best) {
+					best = cost;
+					nibble = n;
+				}
+			}
+		} else {
+			int32_t diff = input - predictor;
+			int32_t step = xm_adpcm_steps[index];
+
+			if(diff < 0) {
+				nibble = 8;
+				diff = -diff;
+			}
+			if(diff >= step) { nibble |= 4; diff -= step; }
+			if(diff >= step >> 1) { nibble |= 2; diff -= step >> 1; }
+			if(diff >= step >> 2) { nibble |= 1; }
+		}
+
+		xm_adpcm_step(nibble, &predictor, &index);
+		error += (uint64_t)((int64_t)(input - predictor) * (input - predictor));
+		if(out) {
+			out[4 + ((i - 1) >> 1)] |= (i & 1) ? nibble : (uint8_t)(nibble << 4);
+		}
+	}
+
+	return error;
+}
+
+bool xm_adpcm_encode(const xm_sample_t* sample, xm_write_func_t write, void* user) {
+	uint8_t block[XM_ADPCM_BLOCK_BYTES];
+
+	for(uint32_t k = 0; k < sample->length; ) {
+		uint32_t first, count;
+		uint64_t best_error = UINT64_MAX;
+		int8_t best = 0;
+
+		xm_adpcm_block_of(sample, k, &first, &count);
+
+		/* Blocks are independent, so each can start with the step
+		 * index that suits it best. This matters for the sharp edges
+		 * of chip style waveforms, which a small step takes many
+		 * samples to catch up with. */
+		for(int8_t index = 0; index <= 88; ++index) {
+			uint64_t error = xm_adpcm_encode_block(sample, k, count, index, false, NULL);
+			if(error < best_error) {
+				best_error = error;
+				best = index;
+			}
+		}
+
+		xm_adpcm_encode_block(sample, k, count, best, true, block);
+		if(!write(user, block, sizeof(block))) return false;
+		k += count;
+	}
+	return true;
+}
+
+#endif
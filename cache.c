@@ -0,0 +1,157 @@
+/* Author: Peter "Projectitis" Vullings <peter@projectitis.com> */
+
+/* This program is free software. It comes without any warranty, to the
+ * extent permitted by applicable law. You can redistribute it and/or
+ * modify it under the terms of the Do What The Fuck You Want To Public
+ * License, Version 2, as published by Sam Hocevar. See
+ * http://sam.zoy.org/wtfpl/COPYING for more details. */
+
+#include "xm_internal.h"
+
+#ifdef XM_SAMPLE_CACHE
+
+/* The cache is a fixed size arena holding decoded waveforms. Entries are
+ * kept sorted by their offset in the arena, so free space is simply the
+ * gaps between consecutive entries. New waveforms go in the first gap
+ * that is large enough; if there is none, least recently triggered
+ * waveforms are evicted until one appears. */
+
+static uint32_t xm_sample_data_size(xm_sample_t* sample) {
+	return PAD_TO_WORD((sample->bits == 16) ? (sample->length << 1) : sample->length);
+}
+
+/* Whether a waveform is audible in any channel. Looped samples never stop
+ * by themselves, so a channel that has been faded or cut to silence does
+ * not count. */
+static bool xm_sample_is_playing(xm_context_t* ctx, xm_sample_t* sample) {
+	for(uint16_t i = 0; i < XM_MIXED_CHANNELS(ctx); ++i) {
+		xm_channel_context_t* ch = ctx->channels + i;
+		if(ch->sample != sample || ch->sample_position < 0) {
+			continue;
+		}
+		#ifdef XM_RAMPING
+			if(ch->target_volume > 0.f) return true;
+		#endif
+		if(ch->actual_volume > 0.f) return true;
+	}
+	return false;
+}
+
+static void xm_sample_cache_evict(xm_context_t* ctx, uint16_t i) {
+	xm_sample_cache_t* cache = ctx->sample_cache;
+	xm_sample_t* sample = cache->entries[i].sample;
+
+	/* Stop silent channels still holding on to the waveform */
+	for(uint16_t j = 0; j < XM_MIXED_CHANNELS(ctx); ++j) {
+		if(ctx->channels[j].sample == sample) {
+			ctx->channels[j].sample_position = -1;
+		}
+	}
+
+	sample->data8 = NULL;
+	memmove(cache->entries + i, cache->entries + i + 1,
+	        (cache->num_entries - i - 1) * sizeof(xm_sample_cache_entry_t));
+	cache->num_entries--;
+	cache->evictions++;
+}
+
+/* Find the first gap of at least size bytes.
+ * Returns the index the new entry should be inserted at, or -1. */
+static int32_t xm_sample_cache_find_gap(xm_sample_cache_t* cache, uint32_t size, uint32_t* offset) {
+	uint32_t end = 0;
+
+	for(uint16_t i = 0; i < cache->num_entries; ++i) {
+		if(cache->entries[i].offset - end >= size) {
+			*offset = end;
+			return i;
+		}
+		end = cache->entries[i].offset + cache->entries[i].size;
+	}
+
+	if(cache->arena_size - end >= size) {
+		*offset = end;
+		return cache->num_entries;
+	}
+
+	return -1;
+}
+
+bool xm_sample_cache_fetch(xm_context_t* ctx, xm_sample_t* sample) {
+	xm_sample_cache_t* cache = ctx->sample_cache;
+	uint32_t size = xm_sample_data_size(sample);
+	uint32_t offset;
+	int32_t at;
+
+	if(cache == NULL || size == 0) {
+		/* Not a cached context, or nothing to decode */
+		return true;
+	}
+
+	cache->clock++;
+
+	if(sample->data8 != NULL) {
+		for(uint16_t i = 0; i < cache->num_entries; ++i) {
+			if(cache->entries[i].sample == sample) {
+				cache->entries[i].last_use = cache->clock;
+				break;
+			}
+		}
+		cache->hits++;
+		return true;
+	}
+
+	cache->misses++;
+	if(size > cache->arena_size) {
+		return false;
+	}
+
+	while((at = xm_sample_cache_find_gap(cache, size, &offset)) < 0) {
+		int32_t lru = -1;
+
+		for(uint16_t i = 0; i < cache->num_entries; ++i) {
+			if((lru < 0 || cache->entries[i].last_use < cache->entries[lru].last_use)
+			   && !xm_sample_is_playing(ctx, cache->entries[i].sample)) {
+				lru = i;
+			}
+		}
+
+		if(lru < 0) {
+			/* Everything in the cache is audible */
+			#ifdef XM_DEBUG
+				sprintf( xm_debugstr, "sample cache full, cannot fit %u bytes\n", size );
+				xm_stdout( xm_debugstr );
+			#endif
+			return false;
+		}
+
+		xm_sample_cache_evict(ctx, lru);
+	}
+
+	memmove(cache->entries + at + 1, cache->entries + at,
+	        (cache->num_entries - at) * sizeof(xm_sample_cache_entry_t));
+	cache->num_entries++;
+	cache->entries[at].sample = sample;
+	cache->entries[at].offset = offset;
+	cache->entries[at].size = size;
+	cache->entries[at].last_use = cache->clock;
+
+	sample->data8 = (int8_t*)(cache->arena + offset);
+	xm_load_sample_data(sample, cache->moddata, cache->moddata_length, sample->data_offset);
+	return true;
+}
+
+void xm_get_sample_cache_stats(xm_context_t* ctx, uint32_t* hits, uint32_t* misses, uint32_t* evictions, size_t* used) {
+	xm_sample_cache_t* cache = ctx->sample_cache;
+
+	if(hits) *hits = cache ? cache->hits : 0;
+	if(misses) *misses = cache ? cache->misses : 0;
+	if(evictions) *evictions = cache ? cache->evictions : 0;
+	if(used) {
+		*used = 0;
+		for(uint16_t i = 0; cache && i < cache->num_entries; ++i) {
+			*used += cache->entries[i].size;
+		}
+	}
+}
+
+#endif
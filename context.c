@@ -12,17 +12,67 @@
 		(ptr) = (void*)((intptr_t)(ptr) + (intptr_t)(*ctxp));	\
 	} while(0)
 
+static void xm_init_channel(xm_channel_context_t* ch) {
+	ch->ping = true;
+	ch->vibrato_waveform = XM_SINE_WAVEFORM;
+	ch->vibrato_waveform_retrigger = true;
+	ch->tremolo_waveform = XM_SINE_WAVEFORM;
+	ch->tremolo_waveform_retrigger = true;
+
+	ch->volume = ch->volume_envelope_volume = ch->fadeout_volume = 1.0f;
+	ch->panning = ch->panning_envelope_panning = .5f;
+	ch->actual_volume = .0f;
+	ch->actual_panning = .5f;
+}
+
+#ifdef XM_SFX_VOICES
+/* Initialises the num_voices voices allocated after the channels */
+void xm_init_voices(xm_context_t* ctx) {
+	if(ctx->num_voices > XM_SFX_VOICES) {
+		ctx->num_voices = XM_SFX_VOICES;
+	}
+	for(uint8_t i = 0; i < ctx->num_voices; ++i) {
+		xm_channel_context_t* ch = ctx->channels + ctx->module.num_channels + i;
+
+		memset(ch, 0, sizeof(xm_channel_context_t));
+		xm_init_channel(ch);
+		ch->current = &ctx->voice_row;
+		ctx->voice_priority[i] = 0;
+	}
+}
+#endif
+
+/* The quality settings belong to whoever plays the context, not to the
+ * module, so a context loaded from an image starts at full quality even
+ * if the one it was made from had been lowered */
+static void xm_reset_quality(xm_context_t* ctx) {
+	ctx->quality = XM_QUALITY_COMPILED;
+	ctx->max_mixed_channels = 0;
+	ctx->tick_frames = 0;
+	for(uint16_t i = 0; i < XM_MIXED_CHANNELS(ctx); ++i) {
+		ctx->channels[i].dropped = false;
+	}
+}
+
 int xm_create_context(xm_context_t** ctxp, const char* moddata, uint32_t rate) {
 	return xm_create_context_safe(ctxp, moddata, SIZE_MAX, rate);
 }
 
-int xm_create_context_safe(xm_context_t** ctxp, const char* moddata, size_t moddata_length, uint32_t rate) {
+/* Shared by xm_create_context_safe(), xm_create_context_cached() and
+ * xm_create_skeleton_context(). load is XM_LOAD_* flags. If only pattern
+ * data is loaded, a sample cache of cache_size bytes is set up to play
+ * the waveforms from. */
+static int xm_create_context_internal(xm_context_t** ctxp, const char* moddata, size_t moddata_length,
+                                      uint32_t rate, uint8_t load, size_t cache_size) {
 	size_t bytes_needed;
 	char* mempool;
 	xm_context_t* ctx;
 	#ifdef XM_DEFENSIVE
 		int ret;
 	#endif
+	#ifdef XM_SAMPLE_CACHE
+		xm_probe_t info;
+	#endif
 	
 	#ifdef XM_DEFENSIVE
 		if((ret = xm_check_sanity_preload(moddata, moddata_length))) {
@@ -34,7 +84,17 @@ int xm_create_context_safe(xm_context_t** ctxp, const char* moddata, size_t modd
 		}
 	#endif
 
-	bytes_needed = xm_get_memory_needed_for_context(moddata, moddata_length);
+	bytes_needed = xm_get_memory_needed_for_context(moddata, moddata_length, load);
+	#ifdef XM_SAMPLE_CACHE
+		if(load == XM_LOAD_PATTERN_DATA) {
+			xm_probe(moddata, moddata_length, &info);
+			bytes_needed += PAD_TO_WORD(sizeof(xm_sample_cache_t))
+				+ PAD_TO_WORD(info.num_samples * sizeof(xm_sample_cache_entry_t))
+				+ PAD_TO_WORD(cache_size);
+		}
+	#else
+		(void)cache_size;
+	#endif
 	mempool = malloc(bytes_needed);
 	if(mempool == NULL && bytes_needed > 0) {
 		/* malloc() failed, trouble ahead */
@@ -53,10 +113,19 @@ int xm_create_context_safe(xm_context_t** ctxp, const char* moddata, size_t modd
 	mempool += PAD_TO_WORD(sizeof(xm_context_t));
 	
 	ctx->rate = rate;
-	mempool = xm_load_module(ctx, moddata, moddata_length, mempool);
+	mempool = xm_load_module(ctx, moddata, moddata_length, mempool, load);
 	
 	ctx->channels = (xm_channel_context_t*)mempool;
-	mempool += PAD_TO_WORD(ctx->module.num_channels * sizeof(xm_channel_context_t));
+	#ifdef XM_SFX_VOICES
+		mempool += PAD_TO_WORD((ctx->module.num_channels + XM_SFX_VOICES) * sizeof(xm_channel_context_t));
+	#else
+		mempool += PAD_TO_WORD(ctx->module.num_channels * sizeof(xm_channel_context_t));
+	#endif
+
+	#ifdef XM_PACKED_PATTERNS
+		ctx->row_cache = (xm_pattern_slot_t*)mempool;
+		mempool += PAD_TO_WORD(ctx->module.num_channels * sizeof(xm_pattern_slot_t));
+	#endif
 
 	ctx->global_volume = 1.f;
 	ctx->amplification = .25f; /* XXX: some bad modules may still clip. Find out something better. */
@@ -65,24 +134,33 @@ int xm_create_context_safe(xm_context_t** ctxp, const char* moddata, size_t modd
 		ctx->volume_ramp = (1.f / 128.f);
 		ctx->panning_ramp = (1.f / 128.f);
 	#endif
+	ctx->quality = XM_QUALITY_COMPILED;
 	
 	for(uint8_t i = 0; i < ctx->module.num_channels; ++i) {
-		xm_channel_context_t* ch = ctx->channels + i;
-
-		ch->ping = true;
-		ch->vibrato_waveform = XM_SINE_WAVEFORM;
-		ch->vibrato_waveform_retrigger = true;
-		ch->tremolo_waveform = XM_SINE_WAVEFORM;
-		ch->tremolo_waveform_retrigger = true;
-
-		ch->volume = ch->volume_envelope_volume = ch->fadeout_volume = 1.0f;
-		ch->panning = ch->panning_envelope_panning = .5f;
-		ch->actual_volume = .0f;
-		ch->actual_panning = .5f;
+		xm_init_channel(ctx->channels + i);
 	}
+	#ifdef XM_SFX_VOICES
+		ctx->num_voices = XM_SFX_VOICES;
+		xm_init_voices(ctx);
+	#endif
 
-	ctx->row_loop_count = (uint8_t*)mempool;
-	mempool += PAD_TO_WORD(MAX_NUM_ROWS * sizeof(uint8_t));
+	ctx->row_visited_stride = xm_get_max_num_rows(ctx->module.patterns, ctx->module.num_patterns);
+	ctx->row_visited = (uint8_t*)mempool;
+	mempool += PAD_TO_WORD(ROW_VISITED_BYTES(ctx->module.length, ctx->row_visited_stride));
+
+	#ifdef XM_SAMPLE_CACHE
+		if(load == XM_LOAD_PATTERN_DATA) {
+			ctx->sample_cache = (xm_sample_cache_t*)mempool;
+			mempool += PAD_TO_WORD(sizeof(xm_sample_cache_t));
+			ctx->sample_cache->moddata = moddata;
+			ctx->sample_cache->moddata_length = moddata_length;
+			ctx->sample_cache->entries = (xm_sample_cache_entry_t*)mempool;
+			mempool += PAD_TO_WORD(info.num_samples * sizeof(xm_sample_cache_entry_t));
+			ctx->sample_cache->arena = mempool;
+			ctx->sample_cache->arena_size = cache_size;
+			mempool += PAD_TO_WORD(cache_size);
+		}
+	#endif
 	
 	#ifdef XM_DEFENSIVE
 		if((ret = xm_check_sanity_postload(ctx))) {
@@ -103,13 +181,188 @@ int xm_create_context_safe(xm_context_t** ctxp, const char* moddata, size_t modd
 	return 0;
 }
 
-void xm_create_context_from_libxmize(xm_context_t** ctxp, const char* libxmized, uint32_t rate) {
+int xm_create_context_safe(xm_context_t** ctxp, const char* moddata, size_t moddata_length, uint32_t rate) {
+	return xm_create_context_internal(ctxp, moddata, moddata_length, rate,
+	                                  XM_LOAD_PATTERN_DATA | XM_LOAD_SAMPLE_DATA, 0);
+}
+
+int xm_create_skeleton_context(xm_context_t** ctxp, const char* moddata, size_t moddata_length, uint32_t rate) {
+	return xm_create_context_internal(ctxp, moddata, moddata_length, rate, 0, 0);
+}
+
+#ifdef XM_SAMPLE_CACHE
+int xm_create_context_cached(xm_context_t** ctxp, const char* moddata, size_t moddata_length, uint32_t rate, size_t cache_size) {
+	return xm_create_context_internal(ctxp, moddata, moddata_length, rate, XM_LOAD_PATTERN_DATA, cache_size);
+}
+#endif
+
+uint32_t xm_image_layout_hash(const uint32_t sizes[XM_IMAGE_NUM_STRUCTS]) {
+	/* FNV-1a */
+	uint32_t hash = 2166136261u;
+
+	for(uint8_t i = 0; i < XM_IMAGE_NUM_STRUCTS; ++i) {
+		for(uint8_t k = 0; k < 4; ++k) {
+			hash ^= (sizes[i] >> (8 * k)) & 0xFF;
+			hash *= 16777619u;
+		}
+	}
+	return hash;
+}
+
+/* Checks shared by plain images and banks. Returns an error message, or
+ * NULL if the image can be loaded by this build. */
+static const char* xm_check_image_header(const char* image, size_t length) {
+	const xm_image_header_t* header = (const void*)image;
+	const uint32_t sizes[XM_IMAGE_NUM_STRUCTS] = {
+		sizeof(xm_context_t), sizeof(xm_module_t), sizeof(xm_pattern_t), sizeof(xm_instrument_t),
+		sizeof(xm_sample_t), sizeof(xm_envelope_t), sizeof(xm_channel_context_t),
+	};
+
+	if(length < sizeof(xm_image_header_t) || memcmp(header->magic, XM_IMAGE_MAGIC, 4) != 0) {
+		return "not a libxmized image";
+	} else if(header->version != XM_IMAGE_VERSION || header->header_size != sizeof(xm_image_header_t)) {
+		return "unsupported image version";
+	} else if(header->layout_hash != xm_image_layout_hash(sizes)) {
+		return "image was made for another platform";
+	} else if(header->features != XM_IMAGE_FEATURES) {
+		return "image was made with other settings in xm.h";
+	} else if(header->image_size > length) {
+		return "image is truncated";
+	}
+
+	for(uint8_t i = 0; i < XM_IMAGE_MAX_SECTIONS; ++i) {
+		const xm_image_section_t* section = header->sections + i;
+
+		if(section->type == XM_SECTION_NONE) continue;
+		if(section->offset > header->image_size || section->length > header->image_size - section->offset) {
+			return "image section out of bounds";
+		}
+	}
+	return NULL;
+}
+
+/* The first section of a type, or NULL */
+static const xm_image_section_t* xm_image_section(const char* image, uint32_t type) {
+	const xm_image_header_t* header = (const void*)image;
+
+	for(uint8_t i = 0; i < XM_IMAGE_MAX_SECTIONS; ++i) {
+		if(header->sections[i].type == type) return header->sections + i;
+	}
+	return NULL;
+}
+
+/* Whether a context section holds a context of its own length */
+static bool xm_image_valid_context(const char* image, const xm_image_section_t* section) {
+	return section != NULL && section->length >= sizeof(xm_context_t)
+		&& ((const xm_context_t*)(image + section->offset))->ctx_size == section->length;
+}
+
+int xm_check_image(const char* image, size_t length, const char** context, size_t* context_length) {
+	const char* error = xm_check_image_header(image, length);
+	const xm_image_section_t* ctx_section = NULL;
+
+	if(error == NULL) {
+		ctx_section = xm_image_section(image, XM_SECTION_CONTEXT);
+		if(!xm_image_valid_context(image, ctx_section)) {
+			error = xm_image_section(image, XM_SECTION_BANK) ? "image is a bank" : "image has no valid context";
+		}
+	}
+
+	if(error) {
+		#ifdef XM_DEBUG
+			sprintf( xm_debugstr, "xm_check_image(): %s\n", error );
+			xm_stdout( xm_debugstr );
+		#endif
+		return 1;
+	}
+
+	*context = image + ctx_section->offset;
+	if(context_length) *context_length = ctx_section->length;
+	return 0;
+}
+
+int xm_check_bank(const char* image, size_t length, uint16_t index, const char** context, uint16_t* num_modules) {
+	const char* error = xm_check_image_header(image, length);
+	const xm_image_section_t* bank = NULL;
+	const xm_image_section_t* table;
+	uint32_t count = 0;
+
+	if(num_modules) *num_modules = 0;
+	if(error == NULL) {
+		bank = xm_image_section(image, XM_SECTION_BANK);
+		if(bank == NULL || bank->length % sizeof(xm_image_section_t) != 0) {
+			error = "not a bank";
+		}
+	}
+	if(error == NULL) {
+		count = bank->length / sizeof(xm_image_section_t);
+		table = (const void*)(image + bank->offset);
+		if(num_modules) *num_modules = (uint16_t)count;
+		if(index >= count) {
+			error = "no such module in bank";
+		} else if(table[index].offset > ((const xm_image_header_t*)image)->image_size
+		          || table[index].length > ((const xm_image_header_t*)image)->image_size - table[index].offset
+		          || !xm_image_valid_context(image, table + index)) {
+			error = "bank module has no valid context";
+		}
+	}
+
+	if(error) {
+		#ifdef XM_DEBUG
+			sprintf( xm_debugstr, "xm_check_bank(): %s\n", error );
+			xm_stdout( xm_debugstr );
+		#endif
+		return 1;
+	}
+
+	*context = image + table[index].offset;
+	return 0;
+}
+
+#ifdef XM_LIBXMIZE_DELTA_SAMPLES
+/* Decode delta encoded waveforms in place, leaving the keyframes after
+ * them unused. Identical waveforms are stored once, so each is decoded
+ * for the first sample using it only. Empty waveforms share their
+ * address with the next one and are left alone. */
+static void xm_undelta_samples(xm_context_t* ctx) {
+	for(uint16_t i = 0; i < ctx->module.num_instruments; ++i) {
+		for(uint16_t j = 0; j < ctx->module.instruments[i].num_samples; ++j) {
+			xm_sample_t* sample = ctx->module.instruments[i].samples + j;
+
+			if(!sample->delta || sample->length == 0) continue;
+			if(sample->bits == 16) {
+				for(uint32_t k = 1; k < sample->length; ++k) {
+					sample->data16[k] += sample->data16[k - 1];
+				}
+			} else {
+				for(uint32_t k = 1; k < sample->length; ++k) {
+					sample->data8[k] += sample->data8[k - 1];
+				}
+			}
+
+			for(uint16_t x = i; x < ctx->module.num_instruments; ++x) {
+				for(uint16_t y = 0; y < ctx->module.instruments[x].num_samples; ++y) {
+					xm_sample_t* other = ctx->module.instruments[x].samples + y;
+					if(other->data8 == sample->data8 && other->length == sample->length) other->delta = false;
+				}
+			}
+		}
+	}
+}
+#endif
+
+int xm_create_context_from_libxmize(xm_context_t** ctxp, const char* libxmized, uint32_t rate) {
 	size_t ctx_size, i, j;
 
-	/* Assume ctx_size is first member of xm_context structure */
-	ctx_size = *(size_t*)libxmized;
+	*ctxp = NULL;
+	if(xm_check_image(libxmized, SIZE_MAX, &libxmized, &ctx_size)) {
+		return 1;
+	}
 
 	*ctxp = malloc(ctx_size);
+	if(*ctxp == NULL) {
+		return 2;
+	}
 	memcpy(*ctxp, libxmized, ctx_size);
 	(*ctxp)->rate = rate;
 
@@ -117,38 +370,77 @@ void xm_create_context_from_libxmize(xm_context_t** ctxp, const char* libxmized,
 
 	OFFSET((*ctxp)->module.patterns);
 	OFFSET((*ctxp)->module.instruments);
-	OFFSET((*ctxp)->row_loop_count);
+	OFFSET((*ctxp)->row_visited);
 	OFFSET((*ctxp)->channels);
+	#ifdef XM_PACKED_PATTERNS
+		OFFSET((*ctxp)->row_cache);
+	#endif
+	#ifdef XM_SFX_VOICES
+		/* Also points their rows at this context */
+		xm_init_voices(*ctxp);
+	#endif
+	xm_reset_quality(*ctxp);
 
 	for(i = 0; i < (*ctxp)->module.num_patterns; ++i) {
 		OFFSET((*ctxp)->module.patterns[i].slots);
 	}
+	/* Older images predate the stride, it always fits in the bitset
+	 * space they reserve */
+	(*ctxp)->row_visited_stride = xm_get_max_num_rows((*ctxp)->module.patterns, (*ctxp)->module.num_patterns);
 
 	for(i = 0; i < (*ctxp)->module.num_instruments; ++i) {
 		OFFSET((*ctxp)->module.instruments[i].samples);
 
 		for(j = 0; j < (*ctxp)->module.instruments[i].num_samples; ++j) {
 			OFFSET((*ctxp)->module.instruments[i].samples[j].data8);
+			#ifdef XM_BAKED_TABLES
+				/* Offset 0 is the context itself, so it means no table */
+				if((*ctxp)->module.instruments[i].samples[j].baked_frequencies) {
+					OFFSET((*ctxp)->module.instruments[i].samples[j].baked_frequencies);
+				}
+			#endif
 		}
+		#ifdef XM_BAKED_TABLES
+			if((*ctxp)->module.instruments[i].volume_envelope.baked) {
+				OFFSET((*ctxp)->module.instruments[i].volume_envelope.baked);
+			}
+			if((*ctxp)->module.instruments[i].panning_envelope.baked) {
+				OFFSET((*ctxp)->module.instruments[i].panning_envelope.baked);
+			}
+		#endif
 	}
+	#ifdef XM_LIBXMIZE_DELTA_SAMPLES
+		xm_undelta_samples(*ctxp);
+	#endif
 	
 	#ifdef XM_DEBUG
 		sprintf( xm_debugstr, "// Module loaded. Context size is %u\n", ctx_size );
 		xm_stdout( xm_debugstr );
 	#endif
+
+	return 0;
 }
 
-void xm_create_shared_context_from_libxmize(xm_context_t** ctxp, const char* libxmized, uint32_t rate) {
+/* Create a context whose pattern and sample data stays in a checked
+ * context section. Offsets are from the start of the section, so they
+ * reach the pool of a bank as well. */
+static int xm_create_shared_context(xm_context_t** ctxp, const char* libxmized, uint32_t rate) {
 	size_t i, j;
 	const xm_context_t* in = (const void*)libxmized;
 	xm_context_t* out;
 	char* alloc;
 
+	const xm_pattern_t* pat = (void*)((intptr_t)in + (intptr_t)in->module.patterns);
+	uint16_t stride = xm_get_max_num_rows(pat, in->module.num_patterns);
+
 	// Calculate size of memory to allocate. This is much less than a normal context because
 	// much of the data (the const data) remains in the shared context.
 	size_t sz = PAD_TO_WORD(sizeof(xm_context_t))
-		+ PAD_TO_WORD(in->module.length * MAX_NUM_ROWS * sizeof(uint8_t))
-		+ PAD_TO_WORD(in->module.num_channels * sizeof(xm_channel_context_t))
+		+ PAD_TO_WORD(ROW_VISITED_BYTES(in->module.length, stride))
+		+ PAD_TO_WORD(XM_MIXED_CHANNELS(in) * sizeof(xm_channel_context_t))
+		#ifdef XM_PACKED_PATTERNS
+		+ PAD_TO_WORD(in->module.num_channels * sizeof(xm_pattern_slot_t))
+		#endif
 		+ PAD_TO_WORD(in->module.num_patterns * sizeof(xm_pattern_t))
 		+ PAD_TO_WORD(in->module.num_instruments * sizeof(xm_instrument_t))
 		;
@@ -160,33 +452,38 @@ void xm_create_shared_context_from_libxmize(xm_context_t** ctxp, const char* lib
 	out = (void*)alloc;
 	*ctxp = out;
 
-	#ifdef XM_DEFENSIVE
-		if(!out) {
-			return;
-		}
-	#endif
+	if(!out) {
+		return 2;
+	}
 	
 	#ifdef XM_DEBUG
 		sprintf( xm_debugstr, "// Saved %.2f%% RAM usage over original XM file format\n", sz, 100.f - 100.f * (float)sz / (float)in->ctx_size );
 		xm_stdout( xm_debugstr );
 	#endif
 
-	#ifdef XM_LIBXMIZE_DELTA_SAMPLES
-		#error Delta coding samples not supported
-	#endif
-
 	// Copy the context struct first
 	memset(alloc, 0, sz);
 	memcpy(out, in, sizeof(xm_context_t));
 	out->rate = rate;
 	alloc += PAD_TO_WORD(sizeof(xm_context_t));
-	out->row_loop_count = (void*)alloc;
-	alloc += PAD_TO_WORD(in->module.length * MAX_NUM_ROWS * sizeof(uint8_t));
+	out->row_visited_stride = stride;
+	out->row_visited = (void*)alloc;
+	alloc += PAD_TO_WORD(ROW_VISITED_BYTES(in->module.length, stride));
 	out->channels = (void*)alloc;
-	alloc += PAD_TO_WORD(in->module.num_channels * sizeof(xm_channel_context_t));
+	alloc += PAD_TO_WORD(XM_MIXED_CHANNELS(in) * sizeof(xm_channel_context_t));
+	/* Channels were initialised when the image was created */
+	memcpy(out->channels, (void*)((intptr_t)in + (intptr_t)in->channels),
+	       XM_MIXED_CHANNELS(in) * sizeof(xm_channel_context_t));
+	#ifdef XM_SFX_VOICES
+		xm_init_voices(out);
+	#endif
+	xm_reset_quality(out);
+	#ifdef XM_PACKED_PATTERNS
+		out->row_cache = (void*)alloc;
+		alloc += PAD_TO_WORD(in->module.num_channels * sizeof(xm_pattern_slot_t));
+	#endif
 	out->module.patterns = (void*)alloc;
 	alloc += PAD_TO_WORD(in->module.num_patterns * sizeof(xm_pattern_t));
-	const xm_pattern_t* pat = (void*)((intptr_t)in + (intptr_t)in->module.patterns);
 	memcpy(out->module.patterns, pat, in->module.num_patterns * sizeof(xm_pattern_t));
 	for(i = 0; i < in->module.num_patterns; ++i) {
 		out->module.patterns[i].slots = (void*)((intptr_t)in + (intptr_t)pat[i].slots);
@@ -202,8 +499,48 @@ void xm_create_shared_context_from_libxmize(xm_context_t** ctxp, const char* lib
 		memcpy(out->module.instruments[i].samples, s, inst[i].num_samples * sizeof(xm_sample_t));
 		for(j = 0; j < inst[i].num_samples; ++j) {
 			out->module.instruments[i].samples[j].data8 = (void*)((intptr_t)in + (intptr_t)s[j].data8);
+			#ifdef XM_BAKED_TABLES
+				/* Tables stay in the image too, offset 0 means none */
+				if(s[j].baked_frequencies) {
+					out->module.instruments[i].samples[j].baked_frequencies = (void*)((intptr_t)in + (intptr_t)s[j].baked_frequencies);
+				}
+			#endif
 		}
+		#ifdef XM_BAKED_TABLES
+			if(inst[i].volume_envelope.baked) {
+				out->module.instruments[i].volume_envelope.baked = (void*)((intptr_t)in + (intptr_t)inst[i].volume_envelope.baked);
+			}
+			if(inst[i].panning_envelope.baked) {
+				out->module.instruments[i].panning_envelope.baked = (void*)((intptr_t)in + (intptr_t)inst[i].panning_envelope.baked);
+			}
+		#endif
 	}
+
+	return 0;
+}
+
+int xm_create_shared_context_from_libxmize(xm_context_t** ctxp, const char* libxmized, uint32_t rate) {
+	*ctxp = NULL;
+	if(xm_check_image(libxmized, SIZE_MAX, &libxmized, NULL)) {
+		return 1;
+	}
+	return xm_create_shared_context(ctxp, libxmized, rate);
+}
+
+int xm_create_shared_context_from_bank(xm_context_t** ctxp, const char* bank, uint16_t index, uint32_t rate) {
+	*ctxp = NULL;
+	if(xm_check_bank(bank, SIZE_MAX, index, &bank, NULL)) {
+		return 1;
+	}
+	return xm_create_shared_context(ctxp, bank, rate);
+}
+
+uint16_t xm_get_bank_size(const char* bank) {
+	const char* context;
+	uint16_t num_modules;
+
+	xm_check_bank(bank, SIZE_MAX, 0, &context, &num_modules);
+	return num_modules;
 }
 
 void xm_free_context(xm_context_t* context) {
@@ -227,6 +564,67 @@ void xm_seek(xm_context_t* ctx, uint8_t pot, uint8_t row, uint16_t tick) {
 	ctx->remaining_samples_in_tick = 0;
 }
 
+void xm_reset(xm_context_t* ctx) {
+	ctx->tempo = ctx->module.tempo;
+	ctx->bpm = ctx->module.bpm;
+	ctx->global_volume = 1.f;
+
+	ctx->current_table_index = 0;
+	ctx->current_row = 0;
+	ctx->current_tick = 0;
+	ctx->remaining_samples_in_tick = 0;
+	ctx->generated_samples = 0;
+	ctx->position_jump = false;
+	ctx->pattern_break = false;
+	ctx->jump_dest = 0;
+	ctx->jump_row = 0;
+	ctx->scheduled_jump = false;
+	ctx->extra_ticks = 0;
+	ctx->tick_frames = 0;
+	#ifdef XM_PACKED_PATTERNS
+		ctx->row_cache_pattern = 0;
+		ctx->row_cache_row = 0;
+		ctx->row_cache_offset = 0;
+	#endif
+
+	ctx->loop_count = 0;
+	memset(ctx->row_visited, 0, ROW_VISITED_BYTES(ctx->module.length, ctx->row_visited_stride));
+
+	for(uint8_t i = 0; i < ctx->module.num_channels; ++i) {
+		xm_channel_context_t* ch = ctx->channels + i;
+		bool muted = ch->muted;
+
+		memset(ch, 0, sizeof(xm_channel_context_t));
+		xm_init_channel(ch);
+		ch->muted = muted;
+	}
+	#ifdef XM_SFX_VOICES
+		xm_init_voices(ctx);
+	#endif
+
+	for(uint16_t i = 0; i < ctx->module.num_instruments; ++i) {
+		xm_instrument_t* instr = ctx->module.instruments + i;
+
+		instr->latest_trigger = 0;
+		for(uint16_t j = 0; j < instr->num_samples; ++j) {
+			instr->samples[j].latest_trigger = 0;
+		}
+	}
+}
+
+bool xm_schedule_jump(xm_context_t* ctx, uint8_t pot, uint8_t row, uint8_t rows, bool fade) {
+	if(pot >= ctx->module.length
+	   || row >= ctx->module.patterns[ctx->module.pattern_table[pot]].num_rows) {
+		return false;
+	}
+	ctx->scheduled_dest = pot;
+	ctx->scheduled_row = row;
+	ctx->scheduled_rows = rows;
+	ctx->scheduled_fade = fade;
+	ctx->scheduled_jump = true;
+	return true;
+}
+
 
 
 bool xm_mute_channel(xm_context_t* ctx, uint16_t channel, bool mute) {
@@ -243,6 +641,24 @@ bool xm_mute_instrument(xm_context_t* ctx, uint16_t instr, bool mute) {
 
 
 
+void xm_set_quality(xm_context_t* ctx, uint8_t quality) {
+	ctx->quality = quality & XM_QUALITY_COMPILED;
+}
+
+uint8_t xm_get_quality(xm_context_t* ctx) {
+	return ctx->quality;
+}
+
+void xm_set_max_mixed_channels(xm_context_t* ctx, uint8_t channels) {
+	ctx->max_mixed_channels = channels;
+}
+
+uint8_t xm_get_max_mixed_channels(xm_context_t* ctx) {
+	return ctx->max_mixed_channels;
+}
+
+
+
 #if XM_STRINGS
 const char* xm_get_module_name(xm_context_t* ctx) {
 	return ctx->module.name;
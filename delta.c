@@ -0,0 +1,114 @@
+/* Author: Peter "Projectitis" Vullings <peter@projectitis.com> */
+
+/* This program is free software. It comes without any warranty, to the
+ * extent permitted by applicable law. You can redistribute it and/or
+ * modify it under the terms of the Do What The Fuck You Want To Public
+ * License, Version 2, as published by Sam Hocevar. See
+ * http://sam.zoy.org/wtfpl/COPYING for more details. */
+
+#include "xm_internal.h"
+
+#ifdef XM_LIBXMIZE_DELTA_SAMPLES
+
+/* Waveforms are stored as the difference of each sample from the one
+ * before it (the first sample as is), in the resolution of the sample,
+ * so they still decode as a whole like the waveforms of a .xm file.
+ *
+ * They are followed by a keyframe for each block of
+ * XM_DELTA_BLOCK_SAMPLES samples: the value of its first sample. The
+ * mixer decodes any block from its keyframe, so loops and ping-pong
+ * loops played backwards never decode from the start of the waveform.
+ * As with ADPCM blocks, looped samples start a new block at
+ * loop_start. */
+
+uint32_t xm_delta_split(const xm_sample_t* sample) {
+	return (sample->loop_type != XM_NO_LOOP && sample->loop_start < sample->length) ? sample->loop_start : 0;
+}
+
+uint32_t xm_delta_block_of(const xm_sample_t* sample, uint32_t k, uint32_t* first, uint32_t* count) {
+	uint32_t split = xm_delta_split(sample);
+	uint32_t before = (split + XM_DELTA_BLOCK_SAMPLES - 1) / XM_DELTA_BLOCK_SAMPLES;
+	uint32_t block, end;
+
+	if(k < split) {
+		block = k / XM_DELTA_BLOCK_SAMPLES;
+		*first = block * XM_DELTA_BLOCK_SAMPLES;
+		end = split;
+	} else {
+		block = before + (k - split) / XM_DELTA_BLOCK_SAMPLES;
+		*first = split + (k - split) / XM_DELTA_BLOCK_SAMPLES * XM_DELTA_BLOCK_SAMPLES;
+		end = sample->length;
+	}
+	*count = (end - *first < XM_DELTA_BLOCK_SAMPLES) ? end - *first : XM_DELTA_BLOCK_SAMPLES;
+	return block;
+}
+
+uint32_t xm_delta_size(const xm_sample_t* sample) {
+	uint32_t first, count;
+
+	if(sample->length == 0) return 0;
+	return (sample->length + xm_delta_block_of(sample, sample->length - 1, &first, &count) + 1)
+		* (sample->bits / 8);
+}
+
+int16_t xm_delta_keyframe(const xm_sample_t* sample, uint32_t block) {
+	if(sample->bits == 16) return sample->data16[sample->length + block];
+	return (int16_t)(sample->data8[sample->length + block] * 256);
+}
+
+void xm_delta_decode_block(const xm_sample_t* sample, uint32_t block, uint32_t first, uint32_t count, int16_t* out) {
+	if(sample->bits == 16) {
+		int16_t v = sample->data16[sample->length + block];
+		const int16_t* d = sample->data16 + first;
+
+		out[0] = v;
+		for(uint32_t i = 1; i < count; ++i) {
+			v += d[i];
+			out[i] = v;
+		}
+	} else {
+		int8_t v = sample->data8[sample->length + block];
+		const int8_t* d = sample->data8 + first;
+
+		out[0] = (int16_t)(v * 256);
+		for(uint32_t i = 1; i < count; ++i) {
+			v += d[i];
+			out[i] = (int16_t)(v * 256);
+		}
+	}
+}
+
+bool xm_delta_encode(const xm_sample_t* sample, xm_write_func_t write, void* user) {
+	uint8_t buf[256];
+	uint32_t n = 0;
+
+	for(uint32_t k = 0; k < sample->length; ++k) {
+		if(sample->bits == 16) {
+			int16_t v = k ? (int16_t)(sample->data16[k] - sample->data16[k - 1]) : sample->data16[k];
+			memcpy(buf + n, &v, 2);
+			n += 2;
+		} else {
+			buf[n++] = (uint8_t)(k ? sample->data8[k] - sample->data8[k - 1] : sample->data8[k]);
+		}
+		if(n == sizeof(buf)) {
+			if(!write(user, buf, n)) return false;
+			n = 0;
+		}
+	}
+	if(n && !write(user, buf, n)) return false;
+
+	/* Keyframes */
+	for(uint32_t k = 0; k < sample->length; ) {
+		uint32_t first, count;
+
+		xm_delta_block_of(sample, k, &first, &count);
+		if(!write(user, (sample->bits == 16) ? (const void*)(sample->data16 + k) : (const void*)(sample->data8 + k),
+		          sample->bits / 8)) {
+			return false;
+		}
+		k += count;
+	}
+	return true;
+}
+
+#endif
@@ -12,6 +12,14 @@
  * 2) Add the header to a sketch and pass it to xm_libxmize (this sketch)
  * 3) Make sure you have serial monitor running
  * 4) Copy/paste the contents from serial to a new .h file. This is the libxmized file!
+ * 
+ * On Teensy 3.5 and 3.6 you can skip the copy/paste and write the header straight to
+ * the SD card instead:
+ * 
+ *    xm_player_xm( shooting_star, shooting_star_size );
+ *    xm_player_save( "ss_xmize.h", SAVETYPE_XMIZE_H );
+ * 
+ * On a PC, xm_libxmize_write() writes the binary image to a FILE* or a buffer.
  */
 
 void setup() {
@@ -16,7 +16,7 @@
 #include "xm_internal.h"
 #include <stdio.h>
 
-#define OFFSET(ptr) do { (ptr) = (void*)((intptr_t)(ptr) - (intptr_t)ctx); } while(0)
+#include <stddef.h>
 
 /**
  * XXX: implement per-waveform zapping 
@@ -41,91 +41,1354 @@ static size_t zero_waveforms(xm_context_t* ctx) {
 }
 */
 
-/**
- * Convert xm module to libxmlized version and output as a byte array to serial. This is an
- * 'unwrapped' version of the module that can be stored in readonly memory.
- **/
-void xm_libxmize( const char* moddata, uint32_t moddata_size ){
-	xm_context_t* ctx;
-	size_t i, j, sz;
-	char outstr[255];
+/* ----- Image layout ----- */
+
+/* A libxmized image is the context mempool with pointers turned into
+ * offsets. To write it for another ABI than the one we run on, every
+ * struct is described by a table of its fields and rebuilt with the
+ * sizes and alignments of the target. */
+
+enum xm_field_kind_e {
+	XM_FIELD_U8,
+	XM_FIELD_U16,
+	XM_FIELD_U32, /* Also float */
+	XM_FIELD_U64,
+	XM_FIELD_ENUM,
+	XM_FIELD_SIZE,
+	XM_FIELD_ULONG,
+	XM_FIELD_PTR,
+	XM_FIELD_STRUCT,
+};
+
+struct xm_struct_s;
+
+typedef struct xm_field_s {
+	uint16_t offset; /* In the host struct */
+	uint8_t kind;
+	uint16_t count; /* Array length, 1 for plain fields */
+	const struct xm_struct_s* type; /* XM_FIELD_STRUCT only */
+} xm_field_t;
+
+typedef struct xm_struct_s {
+	const xm_field_t* fields;
+	uint16_t num_fields;
+	uint16_t host_size;
+} xm_struct_t;
+
+/* Sizes and alignments of each field kind except XM_FIELD_STRUCT */
+typedef struct xm_layout_s {
+	uint8_t size[XM_FIELD_STRUCT];
+	uint8_t align[XM_FIELD_STRUCT];
+} xm_layout_t;
+
+static const xm_layout_t xm_layout_native = {
+	{ 1, 2, 4, 8, sizeof(xm_loop_type_t), sizeof(size_t), sizeof(unsigned long), sizeof(void*) },
+	{ 1, 2, 4, _Alignof(uint64_t), _Alignof(xm_loop_type_t), _Alignof(size_t), _Alignof(unsigned long), _Alignof(void*) },
+};
+
+/* Teensy 3.x: arm-none-eabi, 32 bit pointers, 8 byte aligned uint64_t,
+ * enums as small as their values allow */
+static const xm_layout_t xm_layout_arm32 = {
+	{ 1, 2, 4, 8, 1, 4, 4, 4 },
+	{ 1, 2, 4, 8, 1, 4, 4, 4 },
+};
+
+#define FIELD(type, member, kind) { offsetof(type, member), kind, 1, NULL }
+#define ARRAY(type, member, kind, count) { offsetof(type, member), kind, count, NULL }
+#define STRUCT(type, member, sub, count) { offsetof(type, member), XM_FIELD_STRUCT, count, &sub }
+#define TABLE(type, fields) { fields, sizeof(fields) / sizeof(xm_field_t), sizeof(type) }
+
+static const xm_field_t xm_envelope_point_fields[] = {
+	FIELD(xm_envelope_point_t, frame, XM_FIELD_U16),
+	FIELD(xm_envelope_point_t, value, XM_FIELD_U16),
+};
+static const xm_struct_t xm_envelope_point_struct = TABLE(xm_envelope_point_t, xm_envelope_point_fields);
+
+static const xm_field_t xm_envelope_fields[] = {
+	STRUCT(xm_envelope_t, points, xm_envelope_point_struct, NUM_ENVELOPE_POINTS),
+	FIELD(xm_envelope_t, num_points, XM_FIELD_U8),
+	FIELD(xm_envelope_t, sustain_point, XM_FIELD_U8),
+	FIELD(xm_envelope_t, loop_start_point, XM_FIELD_U8),
+	FIELD(xm_envelope_t, loop_end_point, XM_FIELD_U8),
+	FIELD(xm_envelope_t, enabled, XM_FIELD_U8),
+	FIELD(xm_envelope_t, sustain_enabled, XM_FIELD_U8),
+	FIELD(xm_envelope_t, loop_enabled, XM_FIELD_U8),
+	#ifdef XM_BAKED_TABLES
+		FIELD(xm_envelope_t, baked, XM_FIELD_PTR),
+	#endif
+};
+static const xm_struct_t xm_envelope_struct = TABLE(xm_envelope_t, xm_envelope_fields);
+
+static const xm_field_t xm_sample_fields[] = {
+	#if XM_STRINGS
+		ARRAY(xm_sample_t, name, XM_FIELD_U8, SAMPLE_NAME_LENGTH + 1),
+	#endif
+	FIELD(xm_sample_t, bits, XM_FIELD_U8),
+	#ifdef XM_ADPCM_SAMPLES
+		FIELD(xm_sample_t, adpcm, XM_FIELD_U8),
+	#endif
 	#ifdef XM_LIBXMIZE_DELTA_SAMPLES
-		size_t k;
+		FIELD(xm_sample_t, delta, XM_FIELD_U8),
+	#endif
+	FIELD(xm_sample_t, length, XM_FIELD_U32),
+	FIELD(xm_sample_t, loop_start, XM_FIELD_U32),
+	FIELD(xm_sample_t, loop_length, XM_FIELD_U32),
+	FIELD(xm_sample_t, loop_end, XM_FIELD_U32),
+	FIELD(xm_sample_t, volume, XM_FIELD_U32),
+	FIELD(xm_sample_t, finetune, XM_FIELD_U8),
+	FIELD(xm_sample_t, loop_type, XM_FIELD_ENUM),
+	FIELD(xm_sample_t, panning, XM_FIELD_U32),
+	FIELD(xm_sample_t, relative_note, XM_FIELD_U8),
+	FIELD(xm_sample_t, latest_trigger, XM_FIELD_U64),
+	FIELD(xm_sample_t, data8, XM_FIELD_PTR),
+	#ifdef XM_SAMPLE_CACHE
+		FIELD(xm_sample_t, data_offset, XM_FIELD_U32),
+	#endif
+	#ifdef XM_BAKED_TABLES
+		FIELD(xm_sample_t, baked_frequencies, XM_FIELD_PTR),
+		FIELD(xm_sample_t, baked_first_note, XM_FIELD_U8),
+		FIELD(xm_sample_t, baked_num_notes, XM_FIELD_U8),
+	#endif
+};
+static const xm_struct_t xm_sample_struct = TABLE(xm_sample_t, xm_sample_fields);
+
+static const xm_field_t xm_instrument_fields[] = {
+	#if XM_STRINGS
+		ARRAY(xm_instrument_t, name, XM_FIELD_U8, INSTRUMENT_NAME_LENGTH + 1),
+	#endif
+	FIELD(xm_instrument_t, num_samples, XM_FIELD_U16),
+	ARRAY(xm_instrument_t, sample_of_notes, XM_FIELD_U8, NUM_NOTES),
+	STRUCT(xm_instrument_t, volume_envelope, xm_envelope_struct, 1),
+	STRUCT(xm_instrument_t, panning_envelope, xm_envelope_struct, 1),
+	FIELD(xm_instrument_t, vibrato_type, XM_FIELD_ENUM),
+	FIELD(xm_instrument_t, vibrato_sweep, XM_FIELD_U8),
+	FIELD(xm_instrument_t, vibrato_depth, XM_FIELD_U8),
+	FIELD(xm_instrument_t, vibrato_rate, XM_FIELD_U8),
+	FIELD(xm_instrument_t, volume_fadeout, XM_FIELD_U16),
+	FIELD(xm_instrument_t, latest_trigger, XM_FIELD_U64),
+	FIELD(xm_instrument_t, muted, XM_FIELD_U8),
+	FIELD(xm_instrument_t, samples, XM_FIELD_PTR),
+};
+static const xm_struct_t xm_instrument_struct = TABLE(xm_instrument_t, xm_instrument_fields);
+
+static const xm_field_t xm_pattern_fields[] = {
+	FIELD(xm_pattern_t, num_rows, XM_FIELD_U16),
+	#ifdef XM_PACKED_PATTERNS
+		FIELD(xm_pattern_t, packed_size, XM_FIELD_U16),
+	#endif
+	FIELD(xm_pattern_t, slots, XM_FIELD_PTR),
+};
+static const xm_struct_t xm_pattern_struct = TABLE(xm_pattern_t, xm_pattern_fields);
+
+static const xm_field_t xm_module_fields[] = {
+	#if XM_STRINGS
+		ARRAY(xm_module_t, name, XM_FIELD_U8, MODULE_NAME_LENGTH + 1),
+		ARRAY(xm_module_t, trackername, XM_FIELD_U8, TRACKER_NAME_LENGTH + 1),
+	#endif
+	FIELD(xm_module_t, length, XM_FIELD_U16),
+	FIELD(xm_module_t, restart_position, XM_FIELD_U16),
+	FIELD(xm_module_t, num_channels, XM_FIELD_U16),
+	FIELD(xm_module_t, num_patterns, XM_FIELD_U16),
+	FIELD(xm_module_t, num_instruments, XM_FIELD_U16),
+	FIELD(xm_module_t, tempo, XM_FIELD_U16),
+	FIELD(xm_module_t, bpm, XM_FIELD_U16),
+	FIELD(xm_module_t, frequency_type, XM_FIELD_ENUM),
+	ARRAY(xm_module_t, pattern_table, XM_FIELD_U8, PATTERN_ORDER_TABLE_LENGTH),
+	FIELD(xm_module_t, patterns, XM_FIELD_PTR),
+	FIELD(xm_module_t, instruments, XM_FIELD_PTR),
+};
+static const xm_struct_t xm_module_struct = TABLE(xm_module_t, xm_module_fields);
+
+static const xm_field_t xm_channel_fields[] = {
+	FIELD(xm_channel_context_t, note, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, orig_note, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, instrument, XM_FIELD_PTR),
+	FIELD(xm_channel_context_t, sample, XM_FIELD_PTR),
+	FIELD(xm_channel_context_t, current, XM_FIELD_PTR),
+	FIELD(xm_channel_context_t, sample_position, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, period, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, frequency, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, step, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, ping, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, volume, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, panning, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, autovibrato_ticks, XM_FIELD_U16),
+	FIELD(xm_channel_context_t, sustained, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, fadeout_volume, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, volume_envelope_volume, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, panning_envelope_panning, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, volume_envelope_frame_count, XM_FIELD_U16),
+	FIELD(xm_channel_context_t, panning_envelope_frame_count, XM_FIELD_U16),
+	FIELD(xm_channel_context_t, autovibrato_note_offset, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, arp_in_progress, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, arp_note_offset, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, volume_slide_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, fine_volume_slide_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, global_volume_slide_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, panning_slide_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, portamento_up_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, portamento_down_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, fine_portamento_up_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, fine_portamento_down_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, extra_fine_portamento_up_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, extra_fine_portamento_down_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, tone_portamento_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, tone_portamento_target_period, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, multi_retrig_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, note_delay_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, pattern_loop_origin, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, pattern_loop_count, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, vibrato_in_progress, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, vibrato_waveform, XM_FIELD_ENUM),
+	FIELD(xm_channel_context_t, vibrato_waveform_retrigger, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, vibrato_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, vibrato_ticks, XM_FIELD_U16),
+	FIELD(xm_channel_context_t, vibrato_note_offset, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, tremolo_waveform, XM_FIELD_ENUM),
+	FIELD(xm_channel_context_t, tremolo_waveform_retrigger, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, tremolo_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, tremolo_ticks, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, tremolo_volume, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, tremor_param, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, tremor_on, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, latest_trigger, XM_FIELD_U64),
+	FIELD(xm_channel_context_t, muted, XM_FIELD_U8),
+	FIELD(xm_channel_context_t, dropped, XM_FIELD_U8),
+	#ifdef XM_RAMPING
+		FIELD(xm_channel_context_t, target_panning, XM_FIELD_U32),
+		FIELD(xm_channel_context_t, target_volume, XM_FIELD_U32),
+		FIELD(xm_channel_context_t, frame_count, XM_FIELD_ULONG),
+		ARRAY(xm_channel_context_t, end_of_previous_sample, XM_FIELD_U32, XM_SAMPLE_RAMPING_POINTS),
+	#endif
+	#ifdef XM_ADPCM_SAMPLES
+		FIELD(xm_channel_context_t, adpcm_sample, XM_FIELD_PTR),
+		FIELD(xm_channel_context_t, adpcm_first, XM_FIELD_U32),
+		FIELD(xm_channel_context_t, adpcm_count, XM_FIELD_U32),
+		ARRAY(xm_channel_context_t, adpcm_buffer, XM_FIELD_U16, XM_ADPCM_BLOCK_SAMPLES),
 	#endif
-	uint8_t* ctx_p;
-	uint8_t ctx_val;
-	
-	// Comment start of serial output
 	#ifdef XM_LIBXMIZE_DELTA_SAMPLES
-		xm_stdout("// module data in libxmized format with delta-encoded samples\n");
-	#else
-		xm_stdout("// module data in libxmized format without delta-encoded samples\n");
+		FIELD(xm_channel_context_t, delta_sample, XM_FIELD_PTR),
+		FIELD(xm_channel_context_t, delta_first, XM_FIELD_U32),
+		FIELD(xm_channel_context_t, delta_count, XM_FIELD_U32),
+		ARRAY(xm_channel_context_t, delta_buffer, XM_FIELD_U16, XM_DELTA_BLOCK_SAMPLES),
 	#endif
-	
-	// Create the context. Will use a reasonable amount of memory, so larger XM files will
-	// probably not work. If this becomes an issue then
-	// XXX: write xm_context_to_serial that outputs direct to serial instead of creating context
-	xm_create_context_safe(&ctx, moddata, moddata_size, 48000);
-	if(ctx == NULL){
-		xm_stdout("Error creating the XM context. Aborting.\n");
-		return;
+	FIELD(xm_channel_context_t, actual_panning, XM_FIELD_U32),
+	FIELD(xm_channel_context_t, actual_volume, XM_FIELD_U32),
+};
+static const xm_struct_t xm_channel_struct = TABLE(xm_channel_context_t, xm_channel_fields);
+
+static const xm_field_t xm_context_fields[] = {
+	FIELD(xm_context_t, ctx_size, XM_FIELD_SIZE),
+	STRUCT(xm_context_t, module, xm_module_struct, 1),
+	FIELD(xm_context_t, rate, XM_FIELD_U32),
+	FIELD(xm_context_t, tempo, XM_FIELD_U16),
+	FIELD(xm_context_t, bpm, XM_FIELD_U16),
+	FIELD(xm_context_t, global_volume, XM_FIELD_U32),
+	FIELD(xm_context_t, amplification, XM_FIELD_U32),
+	#ifdef XM_RAMPING
+		FIELD(xm_context_t, volume_ramp, XM_FIELD_U32),
+		FIELD(xm_context_t, panning_ramp, XM_FIELD_U32),
+	#endif
+	FIELD(xm_context_t, quality, XM_FIELD_U8),
+	FIELD(xm_context_t, max_mixed_channels, XM_FIELD_U8),
+	FIELD(xm_context_t, tick_frames, XM_FIELD_U16),
+	FIELD(xm_context_t, current_table_index, XM_FIELD_U8),
+	FIELD(xm_context_t, current_row, XM_FIELD_U8),
+	FIELD(xm_context_t, current_tick, XM_FIELD_U16),
+	FIELD(xm_context_t, remaining_samples_in_tick, XM_FIELD_U32),
+	FIELD(xm_context_t, generated_samples, XM_FIELD_U64),
+	FIELD(xm_context_t, position_jump, XM_FIELD_U8),
+	FIELD(xm_context_t, pattern_break, XM_FIELD_U8),
+	FIELD(xm_context_t, jump_dest, XM_FIELD_U8),
+	FIELD(xm_context_t, jump_row, XM_FIELD_U8),
+	FIELD(xm_context_t, scheduled_jump, XM_FIELD_U8),
+	FIELD(xm_context_t, scheduled_fade, XM_FIELD_U8),
+	FIELD(xm_context_t, scheduled_rows, XM_FIELD_U8),
+	FIELD(xm_context_t, scheduled_dest, XM_FIELD_U8),
+	FIELD(xm_context_t, scheduled_row, XM_FIELD_U8),
+	FIELD(xm_context_t, extra_ticks, XM_FIELD_U16),
+	#ifdef XM_PACKED_PATTERNS
+		FIELD(xm_context_t, row_cache, XM_FIELD_PTR),
+		FIELD(xm_context_t, row_cache_pattern, XM_FIELD_U16),
+		FIELD(xm_context_t, row_cache_row, XM_FIELD_U16),
+		FIELD(xm_context_t, row_cache_offset, XM_FIELD_U16),
+	#endif
+	FIELD(xm_context_t, row_visited, XM_FIELD_PTR),
+	FIELD(xm_context_t, loop_count, XM_FIELD_U8),
+	FIELD(xm_context_t, max_loop_count, XM_FIELD_U8),
+	FIELD(xm_context_t, row_visited_stride, XM_FIELD_U16),
+	FIELD(xm_context_t, channels, XM_FIELD_PTR),
+	#ifdef XM_SFX_VOICES
+		FIELD(xm_context_t, num_voices, XM_FIELD_U8),
+		ARRAY(xm_context_t, voice_priority, XM_FIELD_U8, XM_SFX_VOICES),
+		ARRAY(xm_context_t, voice_row, XM_FIELD_U8, sizeof(xm_pattern_slot_t)),
+	#endif
+	#ifdef XM_SAMPLE_CACHE
+		FIELD(xm_context_t, sample_cache, XM_FIELD_PTR),
+	#endif
+};
+static const xm_struct_t xm_context_struct = TABLE(xm_context_t, xm_context_fields);
+
+/* In the order of xm_image_layout_hash() */
+static const xm_struct_t* const xm_image_structs[XM_IMAGE_NUM_STRUCTS] = {
+	&xm_context_struct, &xm_module_struct, &xm_pattern_struct, &xm_instrument_struct,
+	&xm_sample_struct, &xm_envelope_struct, &xm_channel_struct,
+};
+
+#define ALIGN(offset, align) (((offset) + (align) - 1) / (align) * (align))
+
+/* Size and alignment of a struct in the target layout */
+static size_t xm_struct_size(const xm_struct_t* s, const xm_layout_t* l, size_t* align) {
+	size_t offset = 0, max_align = 1;
+
+	for(uint16_t i = 0; i < s->num_fields; ++i) {
+		const xm_field_t* f = s->fields + i;
+		size_t size, a;
+
+		if(f->kind == XM_FIELD_STRUCT) {
+			size = xm_struct_size(f->type, l, &a);
+		} else {
+			size = l->size[f->kind];
+			a = l->align[f->kind];
+		}
+		offset = ALIGN(offset, a) + size * f->count;
+		if(a > max_align) max_align = a;
 	}
-	
-	// Zero waveforms
-	//sprintf( outstr, "// Saved %u bytes zeroing waveforms\n", zero_waveforms(ctx) );
-	//xm_stdout(outstr);
-	
-	// Ugly pointer offsetting ahead
+
+	if(align) *align = max_align;
+	return ALIGN(offset, max_align);
+}
+
+/* One allocation of the context mempool */
+typedef struct xm_image_object_s {
+	const uint8_t* host;
+	size_t host_size;
+	const void* stream; /* Pattern or sample whose data is decoded from the module as needed */
+	size_t source; /* Offset of streamed data in the module */
+	const xm_struct_t* type; /* NULL for raw data */
+	const xm_sample_t* sample; /* Waveform of this sample to ADPCM or delta encode */
+	uint8_t shareable; /* XM_IMAGE_PATTERN_DATA or XM_IMAGE_SAMPLE_DATA */
+	bool duplicate; /* Same as an earlier object, stored there */
+	uint16_t module; /* Index of the context it belongs to, in banks */
+	uint32_t hash;
+	size_t offset; /* In the image */
+	size_t size; /* In the image */
+} xm_image_object_t;
+
+/* Pattern and sample data are stored once when several patterns or
+ * samples have identical contents */
+#define XM_IMAGE_PATTERN_DATA 1
+#define XM_IMAGE_SAMPLE_DATA 2
+
+typedef struct xm_image_s {
+	const xm_layout_t* layout;
+	xm_image_object_t* objects; /* In mempool order */
+	xm_image_object_t** index; /* The same, sorted by host address */
+	size_t num_objects;
+	size_t size;
+	size_t base; /* Offset pointers are stored relative to */
+
+	/* Streaming from a module, see xm_libxmize_write() */
+	const char* moddata;
+	size_t moddata_length;
+	uint16_t num_channels;
+	uint8_t* scratch[2]; /* Room for the largest streamed object each */
+} xm_image_t;
+
+/* Room for objects, and the index to them */
+static bool xm_image_alloc(xm_image_t* img, size_t max_objects) {
+	img->objects = malloc(max_objects * (sizeof(xm_image_object_t) + sizeof(xm_image_object_t*)));
+	img->index = (xm_image_object_t**)(img->objects + max_objects);
+	img->num_objects = 0;
+	img->moddata = NULL;
+	return img->objects != NULL;
+}
+
+static void xm_image_add(xm_image_t* img, const void* host, const xm_struct_t* type, size_t count,
+                         uint8_t shareable) {
+	xm_image_object_t* o = img->objects + img->num_objects++;
+
+	o->host = host;
+	o->type = type;
+	o->shareable = shareable;
+	o->sample = NULL;
+	o->stream = NULL;
+	o->duplicate = false;
+	o->module = 0;
+	o->host_size = type ? type->host_size * count : count;
+	o->size = type ? xm_struct_size(type, img->layout, NULL) * count : count;
+}
+
+/* Point a pattern or sample of a skeleton context at the object just
+ * added for its data, which is streamed from source in the module. The
+ * object record stands in for the data in offset lookups. */
+static void xm_image_stream(xm_image_t* img, void* owner, void** field, size_t source) {
+	xm_image_object_t* o = img->objects + img->num_objects - 1;
+
+	o->stream = owner;
+	o->source = source;
+	o->host = (const uint8_t*)o;
+	*field = o;
+}
+
+/* Contents of an object. Streamed data is decoded into buf. */
+static const uint8_t* xm_image_data(const xm_image_t* img, const xm_image_object_t* o, uint8_t* buf) {
+	if(o->stream == NULL) return o->host;
+
+	if(o->shareable == XM_IMAGE_PATTERN_DATA) {
+		xm_pattern_t pat = *(const xm_pattern_t*)o->stream;
+		pat.slots = (xm_pattern_slot_t*)buf;
+		xm_load_pattern_data(&pat, img->num_channels, img->moddata, img->moddata_length, o->source);
+	} else {
+		xm_sample_t sample = *(const xm_sample_t*)o->stream;
+		sample.data8 = (int8_t*)buf;
+		xm_load_sample_data(&sample, img->moddata, img->moddata_length, o->source);
+	}
+	return buf;
+}
+
+/* Whether identical raw data is written out the same way by both objects */
+static bool xm_image_same_encoding(const xm_image_object_t* a, const xm_image_object_t* b) {
+	#ifdef XM_ADPCM_SAMPLES
+		/* Blocks restart at the loop start */
+		if(a->sample || b->sample) {
+			return a->sample && b->sample && a->sample->bits == b->sample->bits
+				&& xm_adpcm_split(a->sample) == xm_adpcm_split(b->sample);
+		}
+	#endif
+	#ifdef XM_LIBXMIZE_DELTA_SAMPLES
+		/* So do keyframes */
+		if(a->sample || b->sample) {
+			return a->sample && b->sample && a->sample->bits == b->sample->bits
+				&& xm_delta_split(a->sample) == xm_delta_split(b->sample);
+		}
+	#endif
+	#if !defined(XM_ADPCM_SAMPLES) && !defined(XM_LIBXMIZE_DELTA_SAMPLES)
+		(void)a;
+		(void)b;
+	#endif
+	return true;
+}
+
+/* Find an earlier object with the same contents as objects[i] */
+static bool xm_image_find_duplicate(xm_image_t* img, size_t i) {
+	xm_image_object_t* o = img->objects + i;
+	uint32_t hash = 2166136261u;
+	const uint8_t* data;
+
+	if(!o->shareable || o->host_size == 0) return false;
+	data = xm_image_data(img, o, img->scratch[0]);
+
+	/* FNV-1a */
+	for(size_t k = 0; k < o->host_size; ++k) {
+		hash ^= data[k];
+		hash *= 16777619u;
+	}
+	o->hash = hash;
+
+	for(size_t j = 0; j < i; ++j) {
+		const xm_image_object_t* other = img->objects + j;
+
+		if(other->shareable == o->shareable && !other->duplicate && other->hash == hash
+		   && other->host_size == o->host_size && xm_image_same_encoding(other, o)
+		   && memcmp(xm_image_data(img, other, img->scratch[1]), data, o->host_size) == 0) {
+			o->offset = other->offset;
+			o->duplicate = true;
+			return true;
+		}
+	}
+	return false;
+}
+
+static int xm_image_object_cmp(const void* a, const void* b) {
+	const xm_image_object_t* oa = *(xm_image_object_t* const*)a;
+	const xm_image_object_t* ob = *(xm_image_object_t* const*)b;
+
+	/* Empty objects (zero length waveforms) share their address with
+	 * the next allocation. Sort them first, so pointers to that address
+	 * find the allocation that really lives there. */
+	if(oa->host == ob->host) return (oa->host_size > ob->host_size) - (oa->host_size < ob->host_size);
+	return (oa->host > ob->host) - (oa->host < ob->host);
+}
+
+/* Fill the index for xm_image_offset() */
+static void xm_image_sort(xm_image_t* img) {
+	for(size_t i = 0; i < img->num_objects; ++i) {
+		img->index[i] = img->objects + i;
+	}
+	qsort(img->index, img->num_objects, sizeof(xm_image_object_t*), xm_image_object_cmp);
+}
+
+/* Turn a pointer into the mempool into an offset in the image, relative
+ * to img->base */
+static uint64_t xm_image_offset(const xm_image_t* img, const uint8_t* ptr) {
+	size_t lo = 0, hi = img->num_objects;
+	const xm_image_object_t* o;
+	size_t delta;
+
+	if(ptr == NULL) return 0;
+
+	/* Last object starting at or before ptr */
+	while(hi - lo > 1) {
+		size_t mid = (lo + hi) / 2;
+		if(img->index[mid]->host <= ptr) lo = mid;
+		else hi = mid;
+	}
+	o = img->index[lo];
+	delta = ptr - o->host;
+
+	if(o->type && o->host_size) {
+		return o->offset - img->base + (delta / o->type->host_size) * (o->size / (o->host_size / o->type->host_size))
+			+ delta % o->type->host_size;
+	}
+	return o->offset - img->base + delta;
+}
+
+/* Convert one struct to the target layout. out must be zeroed. */
+static size_t xm_image_convert(const xm_image_t* img, const xm_struct_t* s, const uint8_t* in, uint8_t* out) {
+	const xm_layout_t* l = img->layout;
+	size_t offset = 0, max_align = 1;
+
+	for(uint16_t i = 0; i < s->num_fields; ++i) {
+		const xm_field_t* f = s->fields + i;
+		const uint8_t* src = in + f->offset;
+
+		if(f->kind == XM_FIELD_STRUCT) {
+			size_t a, size = xm_struct_size(f->type, l, &a);
+			offset = ALIGN(offset, a);
+			for(uint16_t j = 0; j < f->count; ++j) {
+				xm_image_convert(img, f->type, src + j * f->type->host_size, out + offset);
+				offset += size;
+			}
+			if(a > max_align) max_align = a;
+			continue;
+		}
+
+		offset = ALIGN(offset, l->align[f->kind]);
+		if(l->align[f->kind] > max_align) max_align = l->align[f->kind];
+
+		for(uint16_t j = 0; j < f->count; ++j) {
+			uint64_t v;
+
+			switch(f->kind) {
+			case XM_FIELD_U8: { uint8_t x; memcpy(&x, src, sizeof(x)); src += sizeof(x); v = x; break; }
+			case XM_FIELD_U16: { uint16_t x; memcpy(&x, src, sizeof(x)); src += sizeof(x); v = x; break; }
+			case XM_FIELD_U32: { uint32_t x; memcpy(&x, src, sizeof(x)); src += sizeof(x); v = x; break; }
+			case XM_FIELD_U64: { uint64_t x; memcpy(&x, src, sizeof(x)); src += sizeof(x); v = x; break; }
+			case XM_FIELD_ENUM: { xm_loop_type_t x; memcpy(&x, src, sizeof(x)); src += sizeof(x); v = x; break; }
+			case XM_FIELD_SIZE: { size_t x; memcpy(&x, src, sizeof(x)); src += sizeof(x); v = x; break; }
+			case XM_FIELD_ULONG: { unsigned long x; memcpy(&x, src, sizeof(x)); src += sizeof(x); v = x; break; }
+			default: { const uint8_t* x; memcpy(&x, src, sizeof(x)); src += sizeof(x); v = xm_image_offset(img, x); break; }
+			}
+
+			/* Little endian, see XM_BIG_ENDIAN */
+			for(uint8_t k = 0; k < l->size[f->kind]; ++k) {
+				out[offset++] = (uint8_t)(v >> (8 * k));
+			}
+		}
+	}
+
+	return ALIGN(offset, max_align);
+}
+
+/* Write raw data, delta or ADPCM encoding samples on the way if asked */
+static bool xm_image_write_raw(const xm_image_t* img, const xm_image_object_t* o, xm_write_func_t write, void* user) {
+	const uint8_t* data = xm_image_data(img, o, img->scratch[0]);
+
+	#if defined(XM_ADPCM_SAMPLES) || defined(XM_LIBXMIZE_DELTA_SAMPLES)
+		if(o->sample) {
+			xm_sample_t sample = *o->sample;
+			sample.data8 = (int8_t*)data;
+			#ifdef XM_ADPCM_SAMPLES
+				return xm_adpcm_encode(&sample, write, user);
+			#else
+				return xm_delta_encode(&sample, write, user);
+			#endif
+		}
+	#endif
+
+	return o->host_size == 0 || write(user, data, o->host_size);
+}
+
+/* Number of allocations in the context mempool */
+static size_t xm_image_max_objects(const xm_context_t* ctx) {
+	size_t num_samples = 0;
+
+	for(uint16_t i = 0; i < ctx->module.num_instruments; ++i) {
+		num_samples += ctx->module.instruments[i].num_samples;
+	}
+	#ifdef XM_BAKED_TABLES
+		/* Two envelope tables per instrument and a notes table per sample */
+		return 6 + ctx->module.num_patterns + 4 * ctx->module.num_instruments + 2 * num_samples;
+	#else
+		return 6 + ctx->module.num_patterns + 2 * ctx->module.num_instruments + num_samples;
+	#endif
+}
+
+/* Collect every allocation of the context mempool, in mempool order.
+ * img->objects must have room for xm_image_max_objects() more.
+ *
+ * For a skeleton context, sources are the offsets of the pattern and
+ * sample data in img->moddata from xm_locate_module_data(). */
+static void xm_image_collect(xm_image_t* img, xm_context_t* ctx, const size_t* sources) {
+	size_t i, j;
+
+	/* Everything the loader allocates from the mempool */
+	xm_image_add(img, ctx, &xm_context_struct, 1, 0);
+	xm_image_add(img, ctx->module.patterns, &xm_pattern_struct, ctx->module.num_patterns, 0);
+	xm_image_add(img, ctx->module.instruments, &xm_instrument_struct, ctx->module.num_instruments, 0);
 	for(i = 0; i < ctx->module.num_patterns; ++i) {
-		OFFSET(ctx->module.patterns[i].slots);
+		xm_pattern_t* pat = ctx->module.patterns + i;
+		#ifdef XM_PACKED_PATTERNS
+			xm_image_add(img, pat->packed, NULL, pat->packed_size, XM_IMAGE_PATTERN_DATA);
+		#else
+			xm_image_add(img, pat->slots, NULL, pat->num_rows * ctx->module.num_channels * sizeof(xm_pattern_slot_t),
+			             XM_IMAGE_PATTERN_DATA);
+		#endif
+		if(sources) xm_image_stream(img, pat, (void**)&pat->slots, *sources++);
 	}
 	for(i = 0; i < ctx->module.num_instruments; ++i) {
-		for(j = 0; j < ctx->module.instruments[i].num_samples; ++j) {		
+		xm_instrument_t* instr = ctx->module.instruments + i;
+		xm_image_add(img, instr->samples, &xm_sample_struct, instr->num_samples, 0);
+		for(j = 0; j < instr->num_samples; ++j) {
+			xm_sample_t* sample = instr->samples + j;
+			xm_image_add(img, sample->data8, NULL, (sample->bits == 16) ? sample->length << 1 : sample->length,
+			             XM_IMAGE_SAMPLE_DATA);
+			if(sources) xm_image_stream(img, sample, (void**)&sample->data8, *sources++);
+			#ifdef XM_ADPCM_SAMPLES
+				img->objects[img->num_objects - 1].sample = sample;
+				img->objects[img->num_objects - 1].size = xm_adpcm_size(sample);
+			#endif
 			#ifdef XM_LIBXMIZE_DELTA_SAMPLES
-			if(ctx->module.instruments[i].samples[j].length > 1) {
-				// Half-ass delta encoding of samples, this compresses much better
-				if(ctx->module.instruments[i].samples[j].bits == 8) {
-					for(size_t k = ctx->module.instruments[i].samples[j].length - 1; k > 0; --k) {
-						ctx->module.instruments[i].samples[j].data8[k] -= ctx->module.instruments[i].samples[j].data8[k-1];
-					}
-				} else {
-					for(size_t k = ctx->module.instruments[i].samples[j].length - 1; k > 0; --k) {
-						ctx->module.instruments[i].samples[j].data16[k] -= ctx->module.instruments[i].samples[j].data16[k-1];
-					}
+				img->objects[img->num_objects - 1].sample = sample;
+				img->objects[img->num_objects - 1].size = xm_delta_size(sample);
+			#endif
+		}
+		#ifdef XM_BAKED_TABLES
+			/* Raw, floats are 32 bit little endian on every target */
+			if(instr->volume_envelope.baked) {
+				xm_image_add(img, instr->volume_envelope.baked, NULL,
+				             (instr->volume_envelope.points[instr->volume_envelope.num_points - 1].frame + 1) * sizeof(float), 0);
+			}
+			if(instr->panning_envelope.baked) {
+				xm_image_add(img, instr->panning_envelope.baked, NULL,
+				             (instr->panning_envelope.points[instr->panning_envelope.num_points - 1].frame + 1) * sizeof(float), 0);
+			}
+			for(j = 0; j < instr->num_samples; ++j) {
+				xm_sample_t* sample = instr->samples + j;
+				if(sample->baked_frequencies) {
+					xm_image_add(img, sample->baked_frequencies, NULL, sample->baked_num_notes * sizeof(float), 0);
 				}
 			}
+		#endif
+	}
+	xm_image_add(img, ctx->channels, &xm_channel_struct, XM_MIXED_CHANNELS(ctx), 0);
+	#ifdef XM_PACKED_PATTERNS
+		xm_image_add(img, ctx->row_cache, NULL, ctx->module.num_channels * sizeof(xm_pattern_slot_t), 0);
+	#endif
+	xm_image_add(img, ctx->row_visited, NULL, ROW_VISITED_BYTES(ctx->module.length, ctx->row_visited_stride), 0);
+}
+
+/* Give objects[i] the next offset in the image, unless an identical
+ * object is stored already */
+static void xm_image_place(xm_image_t* img, size_t i, xm_libxmize_stats_t* stats) {
+	xm_image_object_t* o = img->objects + i;
+
+	if(xm_image_find_duplicate(img, i)) {
+		if(stats) {
+			stats->saved_bytes += PAD_TO_WORD(o->size);
+			if(o->shareable == XM_IMAGE_PATTERN_DATA) stats->shared_patterns++;
+			else stats->shared_samples++;
+		}
+		return;
+	}
+	o->offset = img->size;
+	img->size += PAD_TO_WORD(o->size);
+}
+
+/* Write one object in the target layout. Returns 0, or 1 if a struct
+ * does not fit the conversion buffer, or 3 if the sink failed. */
+static int xm_image_write_object(const xm_image_t* img, const xm_image_object_t* o, const uint8_t* host,
+                                  xm_write_func_t write, void* user) {
+	static const uint8_t zero[4] = { 0 };
+	uint8_t buf[512];
+	bool ok = true;
+
+	if(o->type) {
+		size_t count = o->type->host_size ? o->host_size / o->type->host_size : 0;
+		size_t size = count ? o->size / count : 0;
+
+		if(size > sizeof(buf)) return 1;
+		for(size_t j = 0; j < count && ok; ++j) {
+			const uint8_t* in = host + j * o->type->host_size;
+			#ifdef XM_ADPCM_SAMPLES
+				xm_sample_t sample;
+				if(o->type == &xm_sample_struct) {
+					memcpy(&sample, in, sizeof(sample));
+					sample.adpcm = true;
+					in = (const uint8_t*)&sample;
+				}
+			#endif
+			#ifdef XM_LIBXMIZE_DELTA_SAMPLES
+				xm_sample_t sample;
+				if(o->type == &xm_sample_struct) {
+					memcpy(&sample, in, sizeof(sample));
+					sample.delta = true;
+					in = (const uint8_t*)&sample;
+				}
 			#endif
-			
-			OFFSET(ctx->module.instruments[i].samples[j].data8);
+			memset(buf, 0, size);
+			xm_image_convert(img, o->type, in, buf);
+			ok = write(user, buf, size);
 		}
-		OFFSET(ctx->module.instruments[i].samples);
+	} else {
+		ok = xm_image_write_raw(img, o, write, user);
 	}
-	OFFSET(ctx->module.patterns);
-	OFFSET(ctx->module.instruments);
-	OFFSET(ctx->row_loop_count);
-	OFFSET(ctx->channels);
-	
-	// Write libxmized data to Serial
-	sz = xm_get_memory_needed_for_context( moddata, moddata_size );
-	//sprintf( outstr, "const uint32_t moddata_len = %u;\n", sz );
-	//xm_stdout( outstr );
-	xm_stdout("const char moddata[] = {\n");
-	j = 0;
-	ctx_p = (uint8_t*)ctx;
-	for (i=0; i<sz; i++){
-		if (i==0) xm_stdout(" ");
-		else xm_stdout(",");
-		ctx_val = *ctx_p;
-		sprintf( outstr, "%3u", ctx_val );
-		xm_stdout( outstr );
-		if (++j==64){
-			xm_stdout("\n");
-			j=0;
+	if(ok && PAD_TO_WORD(o->size) > o->size) {
+		ok = write(user, zero, PAD_TO_WORD(o->size) - o->size);
+	}
+	return ok ? 0 : 3;
+}
+
+/* Write a single context as a plain image, or several as a bank.
+ *
+ * A plain image lays the mempool out as it is. In a bank, the context
+ * sections follow a table of them, and the pattern and sample data of
+ * all modules is pooled after the last one, so that data shared by
+ * several modules is stored once. Pointers stay offsets from the start
+ * of their own context, reaching forward into the pool.
+ *
+ * If moddata is not NULL, ctxs is a single skeleton context of it and
+ * pattern and sample data is streamed from it. */
+static int xm_image_write(xm_context_t* const* ctxs, uint16_t num_contexts, bool bank,
+                          const char* moddata, size_t moddata_length, xm_libxmize_target_t target,
+                          xm_write_func_t write, void* user, xm_libxmize_stats_t* stats) {
+	xm_image_t img;
+	xm_context_t header;
+	xm_image_header_t image_header;
+	xm_image_section_t* table = NULL;
+	uint32_t sizes[XM_IMAGE_NUM_STRUCTS];
+	size_t* sources = NULL;
+	size_t max_objects = 0, max_stream = 0, pool = 0, i;
+	uint16_t m;
+	int ret = 0;
+
+	for(m = 0; m < num_contexts; ++m) {
+		#ifdef XM_SAMPLE_CACHE
+			if(ctxs[m]->sample_cache != NULL) {
+				/* Waveforms are not in the mempool */
+				return 1;
+			}
+		#endif
+		max_objects += xm_image_max_objects(ctxs[m]);
+	}
+
+	img.layout = (target == XM_TARGET_ARM32) ? &xm_layout_arm32 : &xm_layout_native;
+	img.base = 0;
+	for(i = 0; i < XM_IMAGE_NUM_STRUCTS; ++i) {
+		sizes[i] = xm_struct_size(xm_image_structs[i], img.layout, NULL);
+	}
+	xm_image_alloc(&img, max_objects);
+	if(bank) table = calloc(num_contexts, sizeof(xm_image_section_t));
+	if(moddata) sources = malloc(max_objects * sizeof(size_t));
+	if(img.objects == NULL || (bank && table == NULL) || (moddata && sources == NULL)) {
+		free(img.objects);
+		free(table);
+		free(sources);
+		return 2;
+	}
+	if(moddata) {
+		xm_locate_module_data(moddata, moddata_length, sources,
+		                      sources + ctxs[0]->module.num_patterns);
+		img.moddata = moddata;
+		img.moddata_length = moddata_length;
+		img.num_channels = ctxs[0]->module.num_channels;
+	}
+
+	/* Collect the contexts, checking that the objects really tile each
+	 * mempool. Anything else means the tables are out of date. */
+	for(m = 0; m < num_contexts && ret == 0; ++m) {
+		size_t first = img.num_objects, host_offset = 0;
+
+		xm_image_collect(&img, ctxs[m], sources);
+		for(i = first; i < img.num_objects; ++i) {
+			xm_image_object_t* o = img.objects + i;
+
+			o->module = m;
+			if(o->stream) {
+				/* Not in the mempool */
+				if(o->host_size > max_stream) max_stream = o->host_size;
+				continue;
+			}
+			if(o->host != (const uint8_t*)ctxs[m] + host_offset) {
+				#ifdef XM_DEBUG
+					sprintf( xm_debugstr, "libxmize: unexpected object at offset %u\n", (unsigned)(o->host - (const uint8_t*)ctxs[m]) );
+					xm_stdout( xm_debugstr );
+				#endif
+				ret = 1;
+				break;
+			}
+			host_offset += PAD_TO_WORD(o->host_size);
 		}
-		ctx_p++;
 	}
-	xm_stdout("};\n");
-	
-	// Free memory
+	free(sources);
+	if(ret == 0 && moddata) {
+		/* Streamed objects are decoded here one at a time, two when
+		 * comparing them for duplicates */
+		img.scratch[0] = malloc(2 * max_stream + 1);
+		img.scratch[1] = img.scratch[0] + max_stream;
+		if(img.scratch[0] == NULL) ret = 2;
+	}
+	if(ret) {
+		free(img.objects);
+		free(table);
+		return ret;
+	}
+	xm_image_sort(&img);
+
+	/* Lay the objects out in mempool order */
+	if(stats) memset(stats, 0, sizeof(*stats));
+	if(bank) {
+		img.size = sizeof(image_header) + num_contexts * sizeof(xm_image_section_t);
+		for(m = 0; m < num_contexts; ++m) {
+			table[m].type = XM_SECTION_CONTEXT;
+			table[m].offset = img.size;
+			for(i = 0; i < img.num_objects; ++i) {
+				if(img.objects[i].module == m && !img.objects[i].shareable) xm_image_place(&img, i, NULL);
+			}
+			table[m].length = img.size - table[m].offset;
+		}
+		pool = img.size;
+		for(i = 0; i < img.num_objects; ++i) {
+			if(img.objects[i].shareable) xm_image_place(&img, i, stats);
+		}
+	} else {
+		img.size = 0;
+		for(i = 0; i < img.num_objects; ++i) {
+			xm_image_place(&img, i, stats);
+		}
+	}
+
+	memset(&image_header, 0, sizeof(image_header));
+	memcpy(image_header.magic, XM_IMAGE_MAGIC, 4);
+	image_header.version = XM_IMAGE_VERSION;
+	image_header.header_size = sizeof(image_header);
+	image_header.layout_hash = xm_image_layout_hash(sizes);
+	image_header.features = XM_IMAGE_FEATURES;
+	if(bank) {
+		image_header.image_size = img.size;
+		image_header.sections[0].type = XM_SECTION_BANK;
+		image_header.sections[0].offset = sizeof(image_header);
+		image_header.sections[0].length = num_contexts * sizeof(xm_image_section_t);
+		image_header.sections[1].type = XM_SECTION_POOL;
+		image_header.sections[1].offset = pool;
+		image_header.sections[1].length = img.size - pool;
+	} else {
+		image_header.image_size = sizeof(image_header) + img.size;
+		image_header.sections[0].type = XM_SECTION_CONTEXT;
+		image_header.sections[0].offset = sizeof(image_header);
+		image_header.sections[0].length = img.size;
+	}
+	if(!write(user, &image_header, sizeof(image_header))
+	   || (bank && !write(user, table, num_contexts * sizeof(xm_image_section_t)))) {
+		ret = 3;
+	}
+
+	/* Each context, then the pool. Plain images are a single pass. */
+	for(m = 0; m <= (bank ? num_contexts : 0) && ret == 0; ++m) {
+		img.base = (bank && m < num_contexts) ? table[m].offset : 0;
+
+		for(i = 0; i < img.num_objects && ret == 0; ++i) {
+			const xm_image_object_t* o = img.objects + i;
+			const uint8_t* host = o->host;
+
+			if(o->duplicate) continue;
+			if(bank && ((m < num_contexts) ? (o->module != m || o->shareable) : !o->shareable)) continue;
+
+			if(host == (const uint8_t*)ctxs[o->module]) {
+				/* The context records its own size */
+				memcpy(&header, host, sizeof(header));
+				header.ctx_size = bank ? table[m].length : img.size;
+				host = (const uint8_t*)&header;
+			}
+			ret = xm_image_write_object(&img, o, host, write, user);
+		}
+	}
+
+	if(stats) stats->image_size = image_header.image_size;
+	if(moddata) free(img.scratch[0]);
+	free(img.objects);
+	free(table);
+	return ret;
+}
+
+int xm_libxmize_context( xm_context_t* ctx, xm_libxmize_target_t target, xm_write_func_t write, void* user,
+                         xm_libxmize_stats_t* stats ){
+	return xm_image_write(&ctx, 1, false, NULL, 0, target, write, user, stats);
+}
+
+int xm_libxmize_bank( xm_context_t* const* ctxs, uint16_t num_modules, xm_libxmize_target_t target,
+                      xm_write_func_t write, void* user, xm_libxmize_stats_t* stats ){
+	if(num_modules == 0) {
+		return 1;
+	}
+	return xm_image_write(ctxs, num_modules, true, NULL, 0, target, write, user, stats);
+}
+
+int xm_libxmize_write( const char* moddata, size_t moddata_size, xm_libxmize_target_t target, xm_write_func_t write, void* user,
+                       xm_libxmize_stats_t* stats ){
+	xm_context_t* ctx;
+	int ret;
+
+	// Only load the headers. Pattern data and waveforms are decoded from moddata
+	// one at a time as the image is written, so RAM use is bounded by the largest
+	// pattern or sample rather than the whole module.
+	if((ret = xm_create_skeleton_context(&ctx, moddata, moddata_size, 48000))) {
+		return ret;
+	}
+
+	ret = xm_image_write(&ctx, 1, false, moddata, moddata_size, target, write, user, stats);
 	xm_free_context(ctx);
+	return ret;
+}
+
+/* ----- Stripping ----- */
+
+/* The player only reads pattern_table[0..length) (and the restart
+ * position when it lies past the end), the instruments named in those
+ * patterns, the samples their note maps point at and, for looped
+ * samples, the data up to the loop end. Everything else is dropped, the
+ * rest renumbered, and the mempool compacted so that it can be written
+ * like any other context. */
+
+#define XM_STRIP_UNUSED 0xFFFF
+
+static bool xm_slot_is_empty(const xm_pattern_slot_t* s) {
+	return s->note == 0 && s->instrument == 0 && s->volume_column == 0
+		&& s->effect_type == 0 && s->effect_param == 0;
+}
+
+static uint8_t xm_strip_instrument(uint8_t instrument, const uint16_t* instrument_map, uint16_t num_instruments) {
+	/* Invalid numbers stay invalid, as they are above the new count too */
+	if(instrument == 0 || instrument > num_instruments) return instrument;
+	return (uint8_t)(instrument_map[instrument - 1] + 1);
+}
+
+#ifdef XM_PACKED_PATTERNS
+/* Length of the packed slot at offset. instrument receives the offset of
+ * its instrument byte, or 0 if it has none. */
+static uint32_t xm_packed_slot_length(const uint8_t* packed, uint16_t packed_size, uint32_t offset,
+                                      uint32_t* instrument) {
+	uint8_t flags = (offset < packed_size) ? packed[offset] : 0;
+
+	if(!(flags & (1 << 7))) {
+		*instrument = offset + 1;
+		return 5;
+	}
+	*instrument = (flags & (1 << 1)) ? offset + 1 + (flags & 1) : 0;
+	return 1 + (flags & 1) + ((flags >> 1) & 1) + ((flags >> 2) & 1) + ((flags >> 3) & 1) + ((flags >> 4) & 1);
+}
+
+/* Drop the slots of removed channels from packed data, in place.
+ * Returns the new packed size. Slots are copied byte for byte, and data
+ * missing from the end of a pattern stays missing (unpacked as zeroes). */
+static uint16_t xm_strip_packed(xm_pattern_t* pat, uint16_t num_channels, const uint16_t* channel_map,
+                                const uint16_t* instrument_map, uint16_t num_instruments) {
+	uint32_t in = 0, out = 0;
+
+	for(uint16_t r = 0; r < pat->num_rows && in < pat->packed_size; ++r) {
+		for(uint16_t c = 0; c < num_channels && in < pat->packed_size; ++c) {
+			uint32_t instrument, length = xm_packed_slot_length(pat->packed, pat->packed_size, in, &instrument);
+			uint32_t end = (in + length < pat->packed_size) ? in + length : pat->packed_size;
+
+			if(channel_map[c] != XM_STRIP_UNUSED) {
+				if(instrument && instrument < end) {
+					pat->packed[instrument] = xm_strip_instrument(pat->packed[instrument], instrument_map, num_instruments);
+				}
+				memmove(pat->packed + out, pat->packed + in, end - in);
+				out += end - in;
+			}
+			in = end;
+		}
+	}
+
+	return (uint16_t)out;
+}
+#endif
+
+/* Slots of row r, unpacking it into row if patterns are packed. offset
+ * tracks the position of the next packed row. */
+static xm_pattern_slot_t* xm_strip_row(const xm_pattern_t* pat, uint16_t r, uint16_t num_channels,
+                                       uint16_t* offset, xm_pattern_slot_t* row) {
+	#ifdef XM_PACKED_PATTERNS
+		(void)r;
+		*offset = xm_unpack_row(pat->packed, pat->packed_size, *offset, row, num_channels);
+		return row;
+	#else
+		(void)offset;
+		(void)row;
+		return pat->slots + r * num_channels;
+	#endif
+}
+
+/* Looped samples never play past the loop end. Ping-pong loops can land
+ * exactly on it when turning around, so they keep that one sample. */
+static size_t xm_strip_tail(xm_sample_t* sample) {
+	uint32_t end;
+	size_t saved;
+
+	if(sample->loop_type == XM_NO_LOOP || sample->loop_length == 0) return 0;
+
+	end = sample->loop_end + (sample->loop_type == XM_PING_PONG_LOOP ? 1 : 0);
+	if(end >= sample->length) return 0;
+
+	saved = (size_t)(sample->length - end) * ((sample->bits == 16) ? 2 : 1);
+	sample->length = end;
+	return saved;
+}
+
+int xm_strip_context( xm_context_t* ctx, xm_strip_stats_t* stats ){
+	xm_module_t* mod = &ctx->module;
+	uint16_t num_patterns = mod->num_patterns, num_instruments = mod->num_instruments, num_channels = mod->num_channels;
+	uint16_t *pattern_map, *instrument_map, *channel_map, n;
+	xm_pattern_slot_t* row;
+	xm_image_t img;
+	bool keep_tails = false;
+	size_t size, i, j;
+	xm_strip_stats_t local;
+
+	if(stats == NULL) stats = &local;
+	memset(stats, 0, sizeof(*stats));
+
+	#ifdef XM_SAMPLE_CACHE
+		if(ctx->sample_cache != NULL) {
+			/* Waveforms are not in the mempool */
+			return 1;
+		}
+	#endif
+	if(mod->restart_position >= PATTERN_ORDER_TABLE_LENGTH) {
+		return 1;
+	}
+	for(i = 0; i < PATTERN_ORDER_TABLE_LENGTH; ++i) {
+		if((i < mod->length || i == mod->restart_position) && mod->pattern_table[i] >= num_patterns) {
+			return 1;
+		}
+	}
+
+	/* Allocate everything up front, so failing leaves the context as it was */
+	pattern_map = malloc((num_patterns + num_instruments + num_channels) * sizeof(uint16_t)
+	                     + num_channels * sizeof(xm_pattern_slot_t) + 1);
+	xm_image_alloc(&img, xm_image_max_objects(ctx));
+	if(pattern_map == NULL || img.objects == NULL) {
+		free(pattern_map);
+		free(img.objects);
+		return 2;
+	}
+	instrument_map = pattern_map + num_patterns;
+	channel_map = instrument_map + num_instruments;
+	row = (xm_pattern_slot_t*)(channel_map + num_channels);
+	memset(pattern_map, 0xFF, (num_patterns + num_instruments + num_channels) * sizeof(uint16_t));
+
+	/* Find what the song can reach */
+	for(i = 0; i < PATTERN_ORDER_TABLE_LENGTH; ++i) {
+		if(i < mod->length || i == mod->restart_position) {
+			pattern_map[mod->pattern_table[i]] = 0;
+		}
+	}
+	for(i = 0; i < num_patterns; ++i) {
+		const xm_pattern_t* pat = mod->patterns + i;
+		uint16_t offset = 0;
+
+		if(pattern_map[i] == XM_STRIP_UNUSED) continue;
+
+		for(uint16_t r = 0; r < pat->num_rows; ++r) {
+			const xm_pattern_slot_t* slots = xm_strip_row(pat, r, num_channels, &offset, row);
+
+			for(uint16_t c = 0; c < num_channels; ++c) {
+				const xm_pattern_slot_t* s = slots + c;
+
+				if(xm_slot_is_empty(s)) continue;
+				channel_map[c] = 0;
+				if(s->instrument > 0 && s->instrument <= num_instruments) {
+					instrument_map[s->instrument - 1] = 0;
+				}
+				if(s->effect_type == 9) {
+					/* Sample offsets can start a note anywhere */
+					keep_tails = true;
+				}
+			}
+		}
+	}
+	#ifdef XM_SFX_VOICES
+		/* Sound effects play instruments by number, whether the song
+		 * uses them or not */
+		for(i = 0; i < num_instruments; ++i) {
+			instrument_map[i] = 0;
+		}
+	#endif
+	if(num_channels > 0 && channel_map[0] == XM_STRIP_UNUSED) {
+		/* Keep at least one channel, even if the song is silent */
+		for(i = 0; i < num_channels && channel_map[i] == XM_STRIP_UNUSED; ++i);
+		if(i == num_channels) channel_map[0] = 0;
+	}
+
+	/* Number what is left */
+	for(i = 0, n = 0; i < num_patterns; ++i) {
+		if(pattern_map[i] != XM_STRIP_UNUSED) pattern_map[i] = n++;
+	}
+	stats->patterns = num_patterns - n;
+	mod->num_patterns = n;
+	for(i = 0, n = 0; i < num_instruments; ++i) {
+		if(instrument_map[i] != XM_STRIP_UNUSED) instrument_map[i] = n++;
+	}
+	stats->instruments = num_instruments - n;
+	mod->num_instruments = n;
+	for(i = 0, n = 0; i < num_channels; ++i) {
+		if(channel_map[i] != XM_STRIP_UNUSED) channel_map[i] = n++;
+	}
+	stats->channels = num_channels - n;
+	mod->num_channels = n;
+
+	/* Patterns, moving them down to their new numbers */
+	for(i = 0; i < num_patterns; ++i) {
+		xm_pattern_t* pat = mod->patterns + i;
+
+		if(pattern_map[i] == XM_STRIP_UNUSED) continue;
+
+		#ifdef XM_PACKED_PATTERNS
+			pat->packed_size = xm_strip_packed(pat, num_channels, channel_map, instrument_map, num_instruments);
+		#else
+			for(uint16_t r = 0; r < pat->num_rows; ++r) {
+				for(uint16_t c = 0; c < num_channels; ++c) {
+					xm_pattern_slot_t s = pat->slots[r * num_channels + c];
+
+					if(channel_map[c] == XM_STRIP_UNUSED) continue;
+					s.instrument = xm_strip_instrument(s.instrument, instrument_map, num_instruments);
+					pat->slots[r * mod->num_channels + channel_map[c]] = s;
+				}
+			}
+		#endif
+		mod->patterns[pattern_map[i]] = *pat;
+	}
+	for(i = 0; i < PATTERN_ORDER_TABLE_LENGTH; ++i) {
+		if(i < mod->length || i == mod->restart_position) {
+			mod->pattern_table[i] = (uint8_t)pattern_map[mod->pattern_table[i]];
+		} else {
+			mod->pattern_table[i] = 0;
+		}
+	}
+
+	/* Instruments and their samples */
+	for(i = 0; i < num_instruments; ++i) {
+		xm_instrument_t* instr = mod->instruments + i;
+		uint16_t sample_map[256];
+
+		if(instrument_map[i] == XM_STRIP_UNUSED) {
+			stats->samples += instr->num_samples;
+			continue;
+		}
+
+		/* Samples no note maps to cannot be played */
+		memset(sample_map, 0xFF, sizeof(sample_map));
+		for(j = 0; j < NUM_NOTES; ++j) {
+			if(instr->sample_of_notes[j] < instr->num_samples) sample_map[instr->sample_of_notes[j]] = 0;
+		}
+		for(j = 0, n = 0; j < instr->num_samples; ++j) {
+			if(j >= 256 || sample_map[j] == XM_STRIP_UNUSED) {
+				stats->samples++;
+				continue;
+			}
+			sample_map[j] = n;
+			instr->samples[n] = instr->samples[j];
+			if(!keep_tails) stats->sample_tail_bytes += xm_strip_tail(instr->samples + n);
+			n++;
+		}
+		for(j = 0; j < NUM_NOTES; ++j) {
+			/* Invalid entries stay invalid, as they are above the new count too */
+			if(instr->sample_of_notes[j] < instr->num_samples) {
+				instr->sample_of_notes[j] = (uint8_t)sample_map[instr->sample_of_notes[j]];
+			}
+		}
+		instr->num_samples = n;
+		mod->instruments[instrument_map[i]] = *instr;
+	}
+
+	for(i = 0; i < num_channels; ++i) {
+		if(channel_map[i] != XM_STRIP_UNUSED) ctx->channels[channel_map[i]] = ctx->channels[i];
+	}
+	#ifdef XM_SFX_VOICES
+		for(i = 0; i < ctx->num_voices; ++i) {
+			ctx->channels[mod->num_channels + i] = ctx->channels[num_channels + i];
+		}
+	#endif
+	ctx->row_visited_stride = xm_get_max_num_rows(mod->patterns, mod->num_patterns);
+
+	/* Compact the mempool. Objects only shrink, so each moves down. */
+	img.layout = &xm_layout_native;
+	img.base = 0;
+	xm_image_collect(&img, ctx, NULL);
+	xm_image_sort(&img);
+	for(i = 0, size = 0; i < img.num_objects; ++i) {
+		img.objects[i].offset = size;
+		size += PAD_TO_WORD(img.objects[i].host_size);
+	}
+
+	#define XM_STRIP_MOVE(ptr) ((ptr) = (void*)((uint8_t*)ctx + xm_image_offset(&img, (const uint8_t*)(ptr))))
+	for(i = 0; i < mod->num_patterns; ++i) {
+		XM_STRIP_MOVE(mod->patterns[i].slots);
+	}
+	for(i = 0; i < mod->num_instruments; ++i) {
+		xm_instrument_t* instr = mod->instruments + i;
+		for(j = 0; j < instr->num_samples; ++j) {
+			XM_STRIP_MOVE(instr->samples[j].data8);
+			#ifdef XM_BAKED_TABLES
+				if(instr->samples[j].baked_frequencies) XM_STRIP_MOVE(instr->samples[j].baked_frequencies);
+			#endif
+		}
+		#ifdef XM_BAKED_TABLES
+			if(instr->volume_envelope.baked) XM_STRIP_MOVE(instr->volume_envelope.baked);
+			if(instr->panning_envelope.baked) XM_STRIP_MOVE(instr->panning_envelope.baked);
+		#endif
+		XM_STRIP_MOVE(instr->samples);
+	}
+	XM_STRIP_MOVE(mod->patterns);
+	XM_STRIP_MOVE(mod->instruments);
+	XM_STRIP_MOVE(ctx->channels);
+	#ifdef XM_PACKED_PATTERNS
+		XM_STRIP_MOVE(ctx->row_cache);
+	#endif
+	XM_STRIP_MOVE(ctx->row_visited);
+	#undef XM_STRIP_MOVE
+
+	for(i = 1; i < img.num_objects; ++i) {
+		const xm_image_object_t* o = img.objects + i;
+		memmove((uint8_t*)ctx + o->offset, o->host, o->host_size);
+	}
+
+	stats->saved_bytes = (ctx->ctx_size > size) ? ctx->ctx_size - size : 0;
+	ctx->ctx_size = size;
+
+	free(img.objects);
+	free(pattern_map);
+	return 0;
+}
+
+bool xm_write_to_buffer( void* user, const void* data, size_t length ){
+	xm_buffer_sink_t* buffer = user;
+
+	if(length > buffer->size - buffer->used) {
+		return false;
+	}
+	memcpy(buffer->data + buffer->used, data, length);
+	buffer->used += length;
+	return true;
+}
+
+#ifndef ARDUINO
+bool xm_write_to_file( void* user, const void* data, size_t length ){
+	return fwrite(data, 1, length, (FILE*)user) == length;
+}
+#endif
+
+/* The header formatter keeps whole lines in its buffer and passes them on
+ * one at a time, so the sink sees few large writes instead of one per
+ * byte. */
+static bool xm_header_flush( xm_header_writer_t* hw ){
+	bool ok = (hw->length == 0) || hw->write(hw->user, hw->line, hw->length);
+	hw->length = 0;
+	return ok;
+}
+
+static bool xm_header_puts( xm_header_writer_t* hw, const char* str ){
+	while(*str) {
+		if(hw->length == sizeof(hw->line) && !xm_header_flush(hw)) {
+			return false;
+		}
+		hw->line[hw->length++] = *str++;
+	}
+	return true;
+}
+
+bool xm_header_begin( xm_header_writer_t* hw, const char* name, xm_write_func_t write, void* user ){
+	hw->write = write;
+	hw->user = user;
+	hw->length = 0;
+	hw->count = 0;
+
+	return xm_header_puts(hw, "const char ")
+		&& xm_header_puts(hw, name)
+		&& xm_header_puts(hw, "[] = {\n")
+		&& xm_header_flush(hw);
+}
+
+bool xm_header_write( void* user, const void* data, size_t length ){
+	xm_header_writer_t* hw = user;
+	const uint8_t* bytes = data;
+
+	for(size_t i = 0; i < length; ++i) {
+		uint8_t v = bytes[i];
+
+		// Same layout as "%3u" with a separator in front
+		if((size_t)hw->length + 4 > sizeof(hw->line) && !xm_header_flush(hw)) {
+			return false;
+		}
+		hw->line[hw->length++] = (hw->count == 0) ? ' ' : ',';
+		hw->line[hw->length++] = (v >= 100) ? '0' + v / 100 : ' ';
+		hw->line[hw->length++] = (v >= 10) ? '0' + (v / 10) % 10 : ' ';
+		hw->line[hw->length++] = '0' + v % 10;
+
+		if((++hw->count & 63) == 0) {
+			hw->line[hw->length++] = '\n';
+			if(!xm_header_flush(hw)) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+bool xm_header_end( xm_header_writer_t* hw ){
+	return xm_header_puts(hw, "};\n") && xm_header_flush(hw);
+}
+
+static bool xm_write_to_stdout( void* user, const void* data, size_t length ){
+	char str[XM_HEADER_LINE_LENGTH + 1];
+
+	(void)user;
+	memcpy(str, data, length);
+	str[length] = 0;
+	xm_stdout(str);
+	return true;
+}
+
+/**
+ * Convert xm module to libxmlized version and output as a byte array to serial. This is an
+ * 'unwrapped' version of the module that can be stored in readonly memory.
+ **/
+void xm_libxmize( const char* moddata, uint32_t moddata_size ){
+	xm_header_writer_t hw;
+	xm_libxmize_stats_t stats;
+	char outstr[100];
+	
+	// Comment start of serial output
+	#if defined(XM_ADPCM_SAMPLES)
+		xm_stdout("// module data in libxmized format with ADPCM samples\n");
+	#elif defined(XM_LIBXMIZE_DELTA_SAMPLES)
+		xm_stdout("// module data in libxmized format with delta-encoded samples\n");
+	#else
+		xm_stdout("// module data in libxmized format without delta-encoded samples\n");
+	#endif
+	
+	xm_header_begin(&hw, "moddata", xm_write_to_stdout, NULL);
+	if(xm_libxmize_write(moddata, moddata_size, XM_TARGET_NATIVE, xm_header_write, &hw, &stats)) {
+		xm_stdout("\nError creating the XM context. Aborting.\n");
+		return;
+	}
+	xm_header_end(&hw);
+	
+	if(stats.saved_bytes) {
+		sprintf( outstr, "// Saved %u bytes storing %u samples and %u patterns once\n",
+		         (unsigned)stats.saved_bytes, stats.shared_samples, stats.shared_patterns );
+		xm_stdout( outstr );
+	}
 }
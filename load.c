@@ -80,12 +80,84 @@ int xm_check_sanity_postload(xm_context_t* ctx) {
 	return 0;
 }
 
-size_t xm_get_memory_needed_for_context(const char* moddata, size_t moddata_length) {
+#ifdef XM_BAKED_TABLES
+uint16_t xm_baked_envelope_frames(bool enabled, uint8_t num_points, uint16_t last_frame) {
+	if(!enabled || num_points < 2 || num_points > NUM_ENVELOPE_POINTS || last_frame >= XM_MAX_BAKED_ENVELOPE_FRAMES) {
+		return 0;
+	}
+	return last_frame + 1;
+}
+
+uint8_t xm_baked_note_range(const uint8_t* sample_of_notes, uint16_t sample, uint8_t* first) {
+	uint8_t last = 0;
+
+	*first = 0;
+	for(uint8_t n = 1; n <= NUM_NOTES; ++n) {
+		if(sample_of_notes[n - 1] != sample) continue;
+		if(*first == 0) *first = n;
+		last = n;
+	}
+	return *first ? last - *first + 1 : 0;
+}
+
+/* Bytes of baked tables of the instrument whose header is at offset */
+static size_t xm_get_memory_needed_for_baked_tables(const char* moddata, size_t moddata_length, size_t offset,
+                                                    uint16_t num_samples) {
+	uint8_t sample_of_notes[NUM_NOTES], first;
+	uint8_t volume_points = READ_U8(offset + 225), panning_points = READ_U8(offset + 226);
+	size_t memory_needed = 0;
+
+	memory_needed += PAD_TO_WORD(sizeof(float) * xm_baked_envelope_frames(
+		READ_U8(offset + 233) & (1 << 0), volume_points, READ_U16(offset + 129 + 4 * (volume_points - 1))));
+	memory_needed += PAD_TO_WORD(sizeof(float) * xm_baked_envelope_frames(
+		READ_U8(offset + 234) & (1 << 0), panning_points, READ_U16(offset + 177 + 4 * (panning_points - 1))));
+
+	READ_MEMCPY(sample_of_notes, offset + 33, NUM_NOTES);
+	for(uint16_t j = 0; j < num_samples; ++j) {
+		memory_needed += PAD_TO_WORD(xm_baked_note_range(sample_of_notes, j, &first) * sizeof(float));
+	}
+	return memory_needed;
+}
+
+/* Allocate and fill the baked tables of an instrument */
+static char* xm_load_baked_tables(xm_context_t* ctx, xm_instrument_t* instr, char* mempool) {
+	xm_envelope_t* envelopes[2] = { &instr->volume_envelope, &instr->panning_envelope };
+
+	for(uint8_t i = 0; i < 2; ++i) {
+		xm_envelope_t* env = envelopes[i];
+		uint16_t frames = 0;
+
+		if(env->num_points >= 1 && env->num_points <= NUM_ENVELOPE_POINTS) {
+			frames = xm_baked_envelope_frames(env->enabled, env->num_points, env->points[env->num_points - 1].frame);
+		}
+
+		if(frames == 0) continue;
+		xm_bake_envelope(env, (float*)mempool);
+		env->baked = (float*)mempool;
+		mempool += PAD_TO_WORD(frames * sizeof(float));
+	}
+
+	for(uint16_t j = 0; j < instr->num_samples; ++j) {
+		xm_sample_t* sample = instr->samples + j;
+
+		sample->baked_num_notes = xm_baked_note_range(instr->sample_of_notes, j, &sample->baked_first_note);
+		if(sample->baked_num_notes == 0) continue;
+		sample->baked_frequencies = (float*)mempool;
+		xm_bake_frequencies(ctx, sample, sample->baked_frequencies);
+		mempool += PAD_TO_WORD(sample->baked_num_notes * sizeof(float));
+	}
+	return mempool;
+}
+#endif
+
+size_t xm_get_memory_needed_for_context(const char* moddata, size_t moddata_length, uint8_t load) {
 	size_t memory_needed = 0;
 	size_t offset = 60; /* Skip the first header */
 	uint16_t num_channels;
 	uint16_t num_patterns;
 	uint16_t num_instruments;
+	uint16_t module_length;
+	uint16_t max_num_rows = 0;
 
 	/* Read the module header */
 	num_channels = READ_U16(offset + 8);
@@ -96,7 +168,7 @@ size_t xm_get_memory_needed_for_context(const char* moddata, size_t moddata_leng
 	num_instruments = READ_U16(offset + 12);
 	memory_needed += PAD_TO_WORD(num_instruments * sizeof(xm_instrument_t));
 
-	memory_needed += PAD_TO_WORD(MAX_NUM_ROWS * READ_U16(offset + 4) * sizeof(uint8_t)); /* Module length */
+	module_length = READ_U16(offset + 4);
 	/* Header size */
 	offset += READ_U32(offset);
 
@@ -105,7 +177,14 @@ size_t xm_get_memory_needed_for_context(const char* moddata, size_t moddata_leng
 		uint16_t num_rows;
 
 		num_rows = READ_U16(offset + 5);
-		memory_needed += PAD_TO_WORD(num_rows * num_channels * sizeof(xm_pattern_slot_t));
+		if(num_rows > max_num_rows) max_num_rows = num_rows;
+		if(load & XM_LOAD_PATTERN_DATA) {
+			#ifdef XM_PACKED_PATTERNS
+				memory_needed += PAD_TO_WORD(READ_U16(offset + 7));
+			#else
+				memory_needed += PAD_TO_WORD(num_rows * num_channels * sizeof(xm_pattern_slot_t));
+			#endif
+		}
 
 		/* Pattern header length + packed pattern data size */
 		offset += READ_U32(offset) + READ_U16(offset + 7);
@@ -122,6 +201,9 @@ size_t xm_get_memory_needed_for_context(const char* moddata, size_t moddata_leng
 
 		if(num_samples > 0) {
 			sample_header_size = READ_U32(offset + 29);
+			#ifdef XM_BAKED_TABLES
+				memory_needed += xm_get_memory_needed_for_baked_tables(moddata, moddata_length, offset, num_samples);
+			#endif
 		}
 
 		/* Instrument header size */
@@ -132,7 +214,9 @@ size_t xm_get_memory_needed_for_context(const char* moddata, size_t moddata_leng
 
 			sample_size = READ_U32(offset);
 			sample_size_aggregate += sample_size;
-			memory_needed += PAD_TO_WORD( sample_size );
+			if(load & XM_LOAD_SAMPLE_DATA) {
+				memory_needed += PAD_TO_WORD( sample_size );
+			}
 			
 			offset += sample_header_size;
 		}
@@ -140,13 +224,292 @@ size_t xm_get_memory_needed_for_context(const char* moddata, size_t moddata_leng
 		offset += sample_size_aggregate;
 	}
 
-	memory_needed += PAD_TO_WORD(num_channels * sizeof(xm_channel_context_t));
+	if(max_num_rows > MAX_NUM_ROWS) max_num_rows = MAX_NUM_ROWS;
+	memory_needed += PAD_TO_WORD(ROW_VISITED_BYTES(module_length, max_num_rows));
+	#ifdef XM_SFX_VOICES
+		memory_needed += PAD_TO_WORD((num_channels + XM_SFX_VOICES) * sizeof(xm_channel_context_t));
+	#else
+		memory_needed += PAD_TO_WORD(num_channels * sizeof(xm_channel_context_t));
+	#endif
+	#ifdef XM_PACKED_PATTERNS
+		memory_needed += PAD_TO_WORD(num_channels * sizeof(xm_pattern_slot_t)); /* Row cache */
+	#endif
 	memory_needed += PAD_TO_WORD(sizeof(xm_context_t));
 
 	return memory_needed;
 }
 
-char* xm_load_module(xm_context_t* ctx, const char* moddata, size_t moddata_length, char* mempool) {
+/* Skip the module header and pattern headers and data.
+ * Returns the offset of the first instrument header. */
+static size_t xm_skip_patterns(const char* moddata, size_t moddata_length, uint32_t* total_rows) {
+	size_t offset = 60;
+	uint16_t num_patterns = READ_U16(offset + 10);
+
+	/* Header size */
+	offset += READ_U32(offset);
+
+	for(uint16_t i = 0; i < num_patterns; ++i) {
+		if(total_rows) *total_rows += READ_U16(offset + 5);
+
+		/* Pattern header length + packed pattern data size */
+		offset += READ_U32(offset) + READ_U16(offset + 7);
+	}
+
+	return offset;
+}
+
+/* Skip an instrument header, its sample headers and its sample data.
+ * Returns the offset of the next instrument header. */
+static size_t xm_skip_instrument(const char* moddata, size_t moddata_length, size_t offset,
+                                 uint16_t* num_samples, uint32_t* sample_data_size) {
+	uint16_t n = READ_U16(offset + 27);
+	uint32_t sample_header_size = 0;
+	uint32_t sample_size_aggregate = 0;
+
+	if(n > 0) {
+		sample_header_size = READ_U32(offset + 29);
+	}
+
+	/* Instrument header size */
+	offset += READ_U32(offset);
+
+	for(uint16_t j = 0; j < n; ++j) {
+		sample_size_aggregate += READ_U32(offset);
+		offset += sample_header_size;
+	}
+
+	if(num_samples) *num_samples += n;
+	if(sample_data_size) *sample_data_size += sample_size_aggregate;
+	return offset + sample_size_aggregate;
+}
+
+int xm_probe(const char* moddata, size_t moddata_length, xm_probe_t* info) {
+	size_t offset;
+
+	memset(info, 0, sizeof(xm_probe_t));
+	if(xm_check_sanity_preload(moddata, moddata_length)) {
+		return 1;
+	}
+
+	READ_MEMCPY(info->module_name, 17, MODULE_NAME_LENGTH);
+	READ_MEMCPY(info->tracker_name, 38, TRACKER_NAME_LENGTH);
+
+	/* Read module header */
+	offset = 60;
+	info->length = READ_U16(offset + 4);
+	info->restart_position = READ_U16(offset + 6);
+	info->num_channels = READ_U16(offset + 8);
+	info->num_patterns = READ_U16(offset + 10);
+	info->num_instruments = READ_U16(offset + 12);
+	info->linear_frequencies = READ_U16(offset + 14) & (1 << 0);
+	info->tempo = READ_U16(offset + 16);
+	info->bpm = READ_U16(offset + 18);
+
+	offset = xm_skip_patterns(moddata, moddata_length, &(info->total_rows));
+	for(uint16_t i = 0; i < info->num_instruments; ++i) {
+		offset = xm_skip_instrument(moddata, moddata_length, offset,
+		                            &(info->num_samples), &(info->sample_data_size));
+	}
+
+	info->memory_needed = xm_get_memory_needed_for_context(moddata, moddata_length,
+	                                                       XM_LOAD_PATTERN_DATA | XM_LOAD_SAMPLE_DATA);
+	return 0;
+}
+
+int xm_probe_instrument_name(const char* moddata, size_t moddata_length, uint16_t instr, char* name) {
+	size_t offset;
+
+	name[0] = 0;
+	if(xm_check_sanity_preload(moddata, moddata_length) || instr == 0 || instr > READ_U16(60 + 12)) {
+		return 1;
+	}
+
+	offset = xm_skip_patterns(moddata, moddata_length, NULL);
+	for(uint16_t i = 1; i < instr; ++i) {
+		offset = xm_skip_instrument(moddata, moddata_length, offset, NULL, NULL);
+	}
+
+	READ_MEMCPY(name, offset + 4, INSTRUMENT_NAME_LENGTH);
+	name[INSTRUMENT_NAME_LENGTH] = 0;
+	return 0;
+}
+
+int xm_probe_instrument_names(const char* moddata, size_t moddata_length, char names[][INSTRUMENT_NAME_LENGTH + 1],
+                              uint16_t max_names) {
+	size_t offset;
+	uint16_t num_instruments;
+
+	if(xm_check_sanity_preload(moddata, moddata_length)) {
+		return 1;
+	}
+
+	num_instruments = READ_U16(60 + 12);
+	offset = xm_skip_patterns(moddata, moddata_length, NULL);
+	for(uint16_t i = 0; i < num_instruments && i < max_names; ++i) {
+		READ_MEMCPY(names[i], offset + 4, INSTRUMENT_NAME_LENGTH);
+		names[i][INSTRUMENT_NAME_LENGTH] = 0;
+		offset = xm_skip_instrument(moddata, moddata_length, offset, NULL, NULL);
+	}
+	return 0;
+}
+
+uint16_t xm_get_max_num_rows(const xm_pattern_t* patterns, uint16_t num_patterns) {
+	uint16_t max_num_rows = 0;
+
+	for(uint16_t i = 0; i < num_patterns; ++i) {
+		if(patterns[i].num_rows > max_num_rows) max_num_rows = patterns[i].num_rows;
+	}
+
+	return (max_num_rows > MAX_NUM_ROWS) ? MAX_NUM_ROWS : max_num_rows;
+}
+
+uint16_t xm_unpack_row(const uint8_t* packed, uint16_t packed_size, uint16_t offset,
+                       xm_pattern_slot_t* row, uint16_t num_channels) {
+	/* Same idea as READ_U8(), pretend the packed data is infinitely
+	 * padded with zeroes */
+	#define PACKED_U8(o) (((o) < packed_size) ? packed[(o)] : 0)
+	uint32_t j = offset;
+
+	for(uint16_t k = 0; k < num_channels; ++k) {
+		uint8_t note = PACKED_U8(j);
+		xm_pattern_slot_t* slot = row + k;
+
+		if(note & (1 << 7)) {
+			/* MSB is set, this is a compressed packet */
+			++j;
+
+			if(note & (1 << 0)) {
+				/* Note follows */
+				slot->note = PACKED_U8(j);
+				++j;
+			} else {
+				slot->note = 0;
+			}
+
+			if(note & (1 << 1)) {
+				/* Instrument follows */
+				slot->instrument = PACKED_U8(j);
+				++j;
+			} else {
+				slot->instrument = 0;
+			}
+
+			if(note & (1 << 2)) {
+				/* Volume column follows */
+				slot->volume_column = PACKED_U8(j);
+				++j;
+			} else {
+				slot->volume_column = 0;
+			}
+
+			if(note & (1 << 3)) {
+				/* Effect follows */
+				slot->effect_type = PACKED_U8(j);
+				++j;
+			} else {
+				slot->effect_type = 0;
+			}
+
+			if(note & (1 << 4)) {
+				/* Effect parameter follows */
+				slot->effect_param = PACKED_U8(j);
+				++j;
+			} else {
+				slot->effect_param = 0;
+			}
+		} else {
+			/* Uncompressed packet */
+			slot->note = note;
+			slot->instrument = PACKED_U8(j + 1);
+			slot->volume_column = PACKED_U8(j + 2);
+			slot->effect_type = PACKED_U8(j + 3);
+			slot->effect_param = PACKED_U8(j + 4);
+			j += 5;
+		}
+	}
+	#undef PACKED_U8
+
+	return (j < packed_size) ? j : packed_size;
+}
+
+void xm_load_sample_data(xm_sample_t* sample, const char* moddata, size_t moddata_length, size_t offset) {
+	/* Sample data is delta-encoded */
+	if(sample->bits == 16) {
+		int16_t v = 0;
+		for(uint32_t k = 0; k < sample->length; ++k) {
+			v = v + (int16_t)READ_U16(offset + (k << 1));
+			sample->data16[k] = v;
+		}
+	} else {
+		int8_t v = 0;
+		for(uint32_t k = 0; k < sample->length; ++k) {
+			v = v + (int8_t)READ_U8(offset + k);
+			sample->data8[k] = v;
+		}
+	}
+}
+
+void xm_locate_module_data(const char* moddata, size_t moddata_length, size_t* patterns, size_t* samples) {
+	size_t offset = 60;
+	uint16_t num_patterns = READ_U16(offset + 10);
+	uint16_t num_instruments = READ_U16(offset + 12);
+
+	/* Header size */
+	offset += READ_U32(offset);
+
+	for(uint16_t i = 0; i < num_patterns; ++i) {
+		*patterns++ = offset;
+		/* Pattern header length + packed pattern data size */
+		offset += READ_U32(offset) + READ_U16(offset + 7);
+	}
+
+	for(uint16_t i = 0; i < num_instruments; ++i) {
+		uint16_t num_samples = READ_U16(offset + 27);
+		uint32_t sample_header_size = (num_samples > 0) ? READ_U32(offset + 29) : 0;
+		size_t headers;
+
+		/* Instrument header size */
+		offset += READ_U32(offset);
+		headers = offset;
+		offset += num_samples * sample_header_size;
+
+		for(uint16_t j = 0; j < num_samples; ++j) {
+			*samples++ = offset;
+			offset += READ_U32(headers + j * sample_header_size);
+		}
+	}
+}
+
+void xm_load_pattern_data(xm_pattern_t* pat, uint16_t num_channels, const char* moddata, size_t moddata_length,
+                          size_t offset) {
+	uint16_t packed_patterndata_size = READ_U16(offset + 7);
+
+	/* Pattern header length */
+	offset += READ_U32(offset);
+
+	#ifdef XM_PACKED_PATTERNS
+		/* Keep the packed data as is, rows are unpacked on demand
+		 * by xm_row() */
+		(void)num_channels;
+		READ_MEMCPY(pat->packed, offset, packed_patterndata_size);
+	#else
+		if(packed_patterndata_size == 0) {
+			/* No pattern data is present */
+			memset(pat->slots, 0, sizeof(xm_pattern_slot_t) * pat->num_rows * num_channels);
+		} else {
+			/* Don't read past the end of the module */
+			size_t available = (moddata_length > offset) ? (moddata_length - offset) : 0;
+			uint16_t packed_size = (packed_patterndata_size < available) ? packed_patterndata_size : available;
+
+			for(uint16_t j = 0, k = 0; k < pat->num_rows; ++k) {
+				j = xm_unpack_row((const uint8_t*)moddata + offset, packed_size, j,
+				                  pat->slots + k * num_channels, num_channels);
+			}
+		}
+	#endif
+}
+
+char* xm_load_module(xm_context_t* ctx, const char* moddata, size_t moddata_length, char* mempool, uint8_t load) {
 	size_t offset = 0;
 	xm_module_t* mod = &(ctx->module);
 
@@ -175,8 +538,8 @@ char* xm_load_module(xm_context_t* ctx, const char* moddata, size_t moddata_leng
 	uint16_t flags = READ_U32(offset + 14);
 	mod->frequency_type = (flags & (1 << 0)) ? XM_LINEAR_FREQUENCIES : XM_AMIGA_FREQUENCIES;
 
-	ctx->tempo = READ_U16(offset + 16);
-	ctx->bpm = READ_U16(offset + 18);
+	ctx->tempo = mod->tempo = READ_U16(offset + 16);
+	ctx->bpm = mod->bpm = READ_U16(offset + 18);
 
 	READ_MEMCPY(mod->pattern_table, offset + 20, PATTERN_ORDER_TABLE_LENGTH);
 	offset += header_size;
@@ -187,78 +550,25 @@ char* xm_load_module(xm_context_t* ctx, const char* moddata, size_t moddata_leng
 		xm_pattern_t* pat = mod->patterns + i;
 
 		pat->num_rows = READ_U16(offset + 5);
+		#ifdef XM_PACKED_PATTERNS
+			pat->packed_size = packed_patterndata_size;
+		#endif
 
-		pat->slots = (xm_pattern_slot_t*)mempool;
-		mempool += PAD_TO_WORD(mod->num_channels * pat->num_rows * sizeof(xm_pattern_slot_t));
-
-		/* Pattern header length */
-		offset += READ_U32(offset);
-
-		if(packed_patterndata_size == 0) {
-			/* No pattern data is present */
-			memset(pat->slots, 0, sizeof(xm_pattern_slot_t) * pat->num_rows * mod->num_channels);
+		if(load & XM_LOAD_PATTERN_DATA) {
+			#ifdef XM_PACKED_PATTERNS
+				pat->packed = (uint8_t*)mempool;
+				mempool += PAD_TO_WORD(packed_patterndata_size);
+			#else
+				pat->slots = (xm_pattern_slot_t*)mempool;
+				mempool += PAD_TO_WORD(mod->num_channels * pat->num_rows * sizeof(xm_pattern_slot_t));
+			#endif
+			xm_load_pattern_data(pat, mod->num_channels, moddata, moddata_length, offset);
 		} else {
-			/* This isn't your typical for loop */
-			for(uint16_t j = 0, k = 0; j < packed_patterndata_size; ++k) {
-				uint8_t note = READ_U8(offset + j);
-				xm_pattern_slot_t* slot = pat->slots + k;
-
-				if(note & (1 << 7)) {
-					/* MSB is set, this is a compressed packet */
-					++j;
-
-					if(note & (1 << 0)) {
-						/* Note follows */
-						slot->note = READ_U8(offset + j);
-						++j;
-					} else {
-						slot->note = 0;
-					}
-
-					if(note & (1 << 1)) {
-						/* Instrument follows */
-						slot->instrument = READ_U8(offset + j);
-						++j;
-					} else {
-						slot->instrument = 0;
-					}
-
-					if(note & (1 << 2)) {
-						/* Volume column follows */
-						slot->volume_column = READ_U8(offset + j);
-						++j;
-					} else {
-						slot->volume_column = 0;
-					}
-
-					if(note & (1 << 3)) {
-						/* Effect follows */
-						slot->effect_type = READ_U8(offset + j);
-						++j;
-					} else {
-						slot->effect_type = 0;
-					}
-
-					if(note & (1 << 4)) {
-						/* Effect parameter follows */
-						slot->effect_param = READ_U8(offset + j);
-						++j;
-					} else {
-						slot->effect_param = 0;
-					}
-				} else {
-					/* Uncompressed packet */
-					slot->note = note;
-					slot->instrument = READ_U8(offset + j + 1);
-					slot->volume_column = READ_U8(offset + j + 2);
-					slot->effect_type = READ_U8(offset + j + 3);
-					slot->effect_param = READ_U8(offset + j + 4);
-					j += 5;
-				}
-			}
+			pat->slots = NULL;
 		}
 
-		offset += packed_patterndata_size;
+		/* Pattern header length + packed pattern data size */
+		offset += READ_U32(offset) + packed_patterndata_size;
 	}
 
 	/* Read instruments */
@@ -353,8 +663,12 @@ char* xm_load_module(xm_context_t* ctx, const char* moddata, size_t moddata_leng
 			#ifdef XM_STRINGS
 				READ_MEMCPY(sample->name, 18, SAMPLE_NAME_LENGTH);
 			#endif
-			sample->data8 = (int8_t*)mempool;
-			mempool += (uint32_t)(PAD_TO_WORD(sample->length));
+			if(load & XM_LOAD_SAMPLE_DATA) {
+				sample->data8 = (int8_t*)mempool;
+				mempool += (uint32_t)(PAD_TO_WORD(sample->length));
+			} else {
+				sample->data8 = NULL;
+			}
 
 			if(sample->bits == 16) {
 				sample->loop_start >>= 1;
@@ -369,24 +683,21 @@ char* xm_load_module(xm_context_t* ctx, const char* moddata, size_t moddata_leng
 		for(uint16_t j = 0; j < instr->num_samples; ++j) {
 			/* Read sample data */
 			xm_sample_t* sample = instr->samples + j;
-			uint32_t length = sample->length;
 
-			if(sample->bits == 16) {
-				int16_t v = 0;
-				for(uint32_t k = 0; k < length; ++k) {
-					v = v + (int16_t)READ_U16(offset + (k << 1));
-					sample->data16[k] = v;
-				}
-				offset += sample->length << 1;
-			} else {
-				int8_t v = 0;
-				for(uint32_t k = 0; k < length; ++k) {
-					v = v + (int8_t)READ_U8(offset + k);
-					sample->data8[k] = v;
-				}
-				offset += sample->length;
+			#ifdef XM_SAMPLE_CACHE
+				sample->data_offset = offset;
+			#endif
+			if(load & XM_LOAD_SAMPLE_DATA) {
+				xm_load_sample_data(sample, moddata, moddata_length, offset);
 			}
+			offset += (sample->bits == 16) ? (sample->length << 1) : sample->length;
 		}
+
+		#ifdef XM_BAKED_TABLES
+			if(instr->num_samples > 0) {
+				mempool = xm_load_baked_tables(ctx, instr, mempool);
+			}
+		#endif
 	}
 
 	return mempool;
@@ -0,0 +1,217 @@
+/* Author: Peter "Projectitis" Vullings <peter@projectitis.com> */
+
+/* This program is free software. It comes without any warranty, to the
+ * extent permitted by applicable law. You can redistribute it and/or
+ * modify it under the terms of the Do What The Fuck You Want To Public
+ * License, Version 2, as published by Sam Hocevar. See
+ * http://sam.zoy.org/wtfpl/COPYING for more details. */
+
+#include "xm_internal.h"
+
+#ifdef XM_HAS_MMAP
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+struct xm_mapped_module_s {
+	const char* data;
+	size_t length;
+};
+
+int xm_map_module(xm_mapped_module_t** mapp, const char* path) {
+	xm_mapped_module_t* map;
+	struct stat st;
+	void* data;
+	int fd;
+
+	*mapp = NULL;
+
+	fd = open(path, O_RDONLY);
+	if(fd < 0) {
+		#ifdef XM_DEBUG
+			sprintf( xm_debugstr, "could not open %s\n", path );
+			xm_stdout( xm_debugstr );
+		#endif
+		return 1;
+	}
+	if(fstat(fd, &st) < 0 || st.st_size <= 0) {
+		close(fd);
+		return 1;
+	}
+
+	data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	/* The mapping keeps its own reference to the file */
+	close(fd);
+	if(data == MAP_FAILED) {
+		#ifdef XM_DEBUG
+			sprintf( xm_debugstr, "could not map %s\n", path );
+			xm_stdout( xm_debugstr );
+		#endif
+		return 1;
+	}
+
+	map = malloc(sizeof(xm_mapped_module_t));
+	if(map == NULL) {
+		munmap(data, (size_t)st.st_size);
+		return 2;
+	}
+	map->data = data;
+	map->length = (size_t)st.st_size;
+
+	*mapp = map;
+	return 0;
+}
+
+/* Whether count items of size bytes at offset run past length bytes.
+ * Written so that neither side can overflow. */
+static int xm_mapped_outside(const void* offset, size_t count, size_t size, size_t length) {
+	if(size != 0 && count > length / size) return 1;
+	return (size_t)offset > length - count * size;
+}
+
+/* Same, for structs and tables, which the image places on word
+ * boundaries */
+static int xm_mapped_outside_word(const void* offset, size_t count, size_t size, size_t length) {
+	return PAD_TO_WORD((size_t)offset) != (size_t)offset || xm_mapped_outside(offset, count, size, length);
+}
+
+/* Bytes of a waveform in the image */
+static size_t xm_mapped_sample_bytes(const xm_sample_t* s) {
+	#ifdef XM_ADPCM_SAMPLES
+		if(s->adpcm) return xm_adpcm_size(s);
+	#endif
+	#ifdef XM_LIBXMIZE_DELTA_SAMPLES
+		if(s->delta) return xm_delta_size(s);
+	#endif
+	return (s->bits == 16) ? (size_t)s->length << 1 : s->length;
+}
+
+static int xm_check_mapped_envelope(const xm_envelope_t* env, size_t length) {
+	if(env->num_points > NUM_ENVELOPE_POINTS) return 1;
+	#ifdef XM_BAKED_TABLES
+		/* The baked table is read up to the last point */
+		if(env->baked == NULL) return 0;
+		if(env->num_points < 2) return 1;
+		return xm_mapped_outside_word(env->baked, env->points[env->num_points - 1].frame + 1, sizeof(float), length);
+	#else
+		(void)length;
+		return 0;
+	#endif
+}
+
+static int xm_check_mapped_sample(const xm_sample_t* s, size_t length) {
+	if(s->bits != 8 && s->bits != 16) return 1;
+	if(s->loop_type != XM_NO_LOOP
+	   && (s->loop_end > s->length || s->loop_start > s->loop_end
+	       || s->loop_length != s->loop_end - s->loop_start)) {
+		return 1;
+	}
+	if(xm_mapped_outside(s->data8, xm_mapped_sample_bytes(s), 1, length)) return 1;
+	#ifdef XM_BAKED_TABLES
+		if(s->baked_frequencies != NULL
+		   && xm_mapped_outside_word(s->baked_frequencies, s->baked_num_notes, sizeof(float), length)) {
+			return 1;
+		}
+	#endif
+	return 0;
+}
+
+/* Check that the offsets in the context section of a libxmized image,
+ * and everything they reach, stay inside it before the shared loader
+ * follows them. The loader copies the channels and keeps pointers to
+ * pattern and sample data, which play() then indexes by the counts and
+ * lengths checked here. */
+static int xm_check_mapped_libxmize(const char* data, size_t length) {
+	const xm_context_t* in = (const void*)data;
+	const xm_pattern_t* pat;
+	const xm_instrument_t* inst;
+
+	if(in->module.length == 0 || in->module.length > PATTERN_ORDER_TABLE_LENGTH
+	   || in->module.num_channels == 0) {
+		return 1;
+	}
+	#ifdef XM_SFX_VOICES
+		if(in->num_voices != XM_SFX_VOICES) return 1;
+	#endif
+	if(xm_mapped_outside_word(in->module.patterns, in->module.num_patterns, sizeof(xm_pattern_t), length)) return 1;
+	if(xm_mapped_outside_word(in->module.instruments, in->module.num_instruments, sizeof(xm_instrument_t), length)) return 1;
+	if(xm_mapped_outside_word(in->channels, XM_MIXED_CHANNELS(in), sizeof(xm_channel_context_t), length)) return 1;
+
+	for(uint16_t i = 0; i < in->module.length; ++i) {
+		if(in->module.pattern_table[i] >= in->module.num_patterns) return 1;
+	}
+	/* The song loops to here, through the 8 bit table index */
+	if(in->module.pattern_table[(uint8_t)in->module.restart_position] >= in->module.num_patterns) return 1;
+
+	pat = (const void*)(data + (intptr_t)in->module.patterns);
+	for(uint16_t i = 0; i < in->module.num_patterns; ++i) {
+		#ifdef XM_PACKED_PATTERNS
+			if(xm_mapped_outside(pat[i].packed, pat[i].packed_size, 1, length)) return 1;
+		#else
+			if(xm_mapped_outside(pat[i].slots, (size_t)pat[i].num_rows * in->module.num_channels,
+			                     sizeof(xm_pattern_slot_t), length)) {
+				return 1;
+			}
+		#endif
+	}
+
+	inst = (const void*)(data + (intptr_t)in->module.instruments);
+	for(uint16_t i = 0; i < in->module.num_instruments; ++i) {
+		const xm_sample_t* s;
+
+		if(xm_mapped_outside_word(inst[i].samples, inst[i].num_samples, sizeof(xm_sample_t), length)) return 1;
+		s = (const void*)(data + (intptr_t)inst[i].samples);
+		for(uint16_t j = 0; j < inst[i].num_samples; ++j) {
+			if(xm_check_mapped_sample(s + j, length)) return 1;
+		}
+		if(xm_check_mapped_envelope(&inst[i].volume_envelope, length)
+		   || xm_check_mapped_envelope(&inst[i].panning_envelope, length)) {
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+int xm_create_context_from_mapped(xm_context_t** ctxp, const xm_mapped_module_t* map, uint32_t rate) {
+	const char* context;
+	size_t length;
+	int ret;
+
+	*ctxp = NULL;
+
+	if(map->length >= 17 && memcmp(map->data, "Extended Module: ", 17) == 0) {
+		return xm_create_context_safe(ctxp, map->data, map->length, rate);
+	}
+
+	if(xm_check_image(map->data, map->length, &context, &length)
+	   || xm_check_mapped_libxmize(context, length)) {
+		#ifdef XM_DEBUG
+			sprintf( xm_debugstr, "mapped file is neither a .xm module nor a valid libxmized image\n" );
+			xm_stdout( xm_debugstr );
+		#endif
+		return 1;
+	}
+
+	ret = xm_create_shared_context_from_libxmize(ctxp, map->data, rate);
+	if(ret) return ret;
+	/* Start from the module rather than the playback state stored in the
+	 * file, which is not checked */
+	xm_reset(*ctxp);
+	return 0;
+}
+
+const char* xm_get_mapped_data(const xm_mapped_module_t* map, size_t* length) {
+	if(length) *length = map->length;
+	return map->data;
+}
+
+void xm_unmap_module(xm_mapped_module_t* map) {
+	if(map == NULL) return;
+	munmap((void*)map->data, map->length);
+	free(map);
+}
+
+#endif
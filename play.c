@@ -22,6 +22,7 @@ static void xm_panning_slide(xm_channel_context_t*, uint8_t);
 static void xm_volume_slide(xm_channel_context_t*, uint8_t);
 
 static float xm_envelope_lerp(xm_envelope_point_t*, xm_envelope_point_t*, uint16_t);
+static float xm_envelope_value(xm_envelope_t*, uint16_t);
 static void xm_envelope_tick(xm_channel_context_t*, xm_envelope_t*, uint16_t*, float*);
 static void xm_envelopes(xm_channel_context_t*);
 
@@ -32,6 +33,10 @@ static float xm_amiga_frequency(float);
 static float xm_period(xm_context_t*, float);
 static float xm_frequency(xm_context_t*, float, float);
 static void xm_update_frequency(xm_context_t*, xm_channel_context_t*);
+static void xm_note_period(xm_context_t*, xm_channel_context_t*);
+#ifdef XM_BAKED_TABLES
+static const float* xm_baked_frequency(const xm_channel_context_t*);
+#endif
 
 static void xm_handle_note_and_instrument(xm_context_t*, xm_channel_context_t*, xm_pattern_slot_t*);
 static void xm_trigger_note(xm_context_t*, xm_channel_context_t*, unsigned int flags);
@@ -39,11 +44,14 @@ static void xm_cut_note(xm_channel_context_t*);
 static void xm_key_off(xm_channel_context_t*);
 
 static void xm_post_pattern_change(xm_context_t*);
+static xm_pattern_slot_t* xm_pattern_row(xm_context_t*, uint8_t, uint8_t);
 static void xm_row(xm_context_t*);
 static void xm_tick(xm_context_t*);
 
-static float xm_sample_at(xm_sample_t*, size_t);
-static float xm_next_of_sample(xm_channel_context_t*);
+static float xm_sample_at(xm_channel_context_t*, size_t);
+static float xm_next_of_sample(xm_context_t*, xm_channel_context_t*);
+static void xm_skip_sample(xm_channel_context_t*, uint32_t);
+static void xm_drop_quietest(xm_context_t*);
 static void xm_sample(xm_context_t*, float*, float*);
 
 /* ----- Other oddities ----- */
@@ -411,6 +419,53 @@ static void xm_update_frequency(xm_context_t* ctx, xm_channel_context_t* ch) {
 	ch->step = ch->frequency / ctx->rate;
 }
 
+#ifdef XM_BAKED_TABLES
+/* Baked frequency of ch->note, if it is a pattern note of ch->sample
+ * played with the sample's own finetune */
+static const float* xm_baked_frequency(const xm_channel_context_t* ch) {
+	const xm_sample_t* sample = ch->sample;
+	int note;
+
+	if(sample == NULL || sample->baked_frequencies == NULL) return NULL;
+
+	note = (int)floorf(ch->note - sample->relative_note - sample->finetune / 128.f + 1.5f);
+	if(note < sample->baked_first_note || note >= sample->baked_first_note + sample->baked_num_notes) return NULL;
+
+	/* Same expression as xm_handle_note_and_instrument(), so the
+	 * tables are only used for the exact same note */
+	if(note + sample->relative_note + sample->finetune / 128.f - 1.f != ch->note) return NULL;
+	return sample->baked_frequencies + (note - sample->baked_first_note);
+}
+
+void xm_bake_frequencies(xm_context_t* ctx, xm_sample_t* sample, float* table) {
+	for(uint8_t i = 0; i < sample->baked_num_notes; ++i) {
+		uint8_t note = sample->baked_first_note + i;
+
+		table[i] = xm_frequency(ctx, xm_period(ctx, note + sample->relative_note + sample->finetune / 128.f - 1.f), 0.f);
+	}
+}
+#endif
+
+/* Period and frequency of a note as it starts */
+static void xm_note_period(xm_context_t* ctx, xm_channel_context_t* ch) {
+	#ifdef XM_BAKED_TABLES
+		const float* baked = xm_baked_frequency(ch);
+	#endif
+
+	ch->period = xm_period(ctx, ch->note);
+
+	#ifdef XM_BAKED_TABLES
+		if(baked != NULL && ch->arp_note_offset == 0
+		   && ch->vibrato_note_offset + ch->autovibrato_note_offset == 0.f) {
+			ch->frequency = *baked;
+			ch->step = ch->frequency / ctx->rate;
+			return;
+		}
+	#endif
+
+	xm_update_frequency(ctx, ch);
+}
+
 static void xm_handle_note_and_instrument(xm_context_t* ctx, xm_channel_context_t* ch,
 										  xm_pattern_slot_t* s) {
 	if(s->instrument > 0) {
@@ -448,10 +503,14 @@ static void xm_handle_note_and_instrument(xm_context_t* ctx, xm_channel_context_
 		} else {
 			if(instr->sample_of_notes[s->note - 1] < instr->num_samples) {
 				#ifdef XM_RAMPING
-					for(unsigned int z = 0; z < XM_SAMPLE_RAMPING_POINTS; ++z) {
-						ch->end_of_previous_sample[z] = xm_next_of_sample(ch);
+					if(XM_RAMPING_ON(ctx)) {
+						for(unsigned int z = 0; z < XM_SAMPLE_RAMPING_POINTS; ++z) {
+							ch->end_of_previous_sample[z] = xm_next_of_sample(ctx, ch);
+						}
+						ch->frame_count = 0;
+					} else {
+						ch->frame_count = XM_SAMPLE_RAMPING_POINTS;
 					}
-					ch->frame_count = 0;
 				#endif
 				ch->sample = instr->samples + instr->sample_of_notes[s->note - 1];
 				ch->orig_note = ch->note = s->note + ch->sample->relative_note
@@ -573,7 +632,8 @@ static void xm_handle_note_and_instrument(xm_context_t* ctx, xm_channel_context_
 		break;
 
 	case 9: /* 9xx: Sample offset */
-		if(ch->sample != NULL && NOTE_IS_VALID(s->note)) {
+		/* A waveform the cache could not load stays silent */
+		if(ch->sample != NULL && XM_SAMPLE_LOADED(ch->sample) && NOTE_IS_VALID(s->note)) {
 			uint32_t final_offset = s->effect_param << (ch->sample->bits == 16 ? 7 : 8);
 			if(final_offset >= ch->sample->length) {
 				/* Pretend the sample dosen't loop and is done playing */
@@ -795,9 +855,17 @@ static void xm_trigger_note(xm_context_t* ctx, xm_channel_context_t* ch, unsigne
 	if(!(flags & XM_TRIGGER_KEEP_SAMPLE_POSITION)) {
 		ch->sample_position = 0.f;
 		ch->ping = true;
+		ch->dropped = false; /* Nothing to catch up on */
 	}
 
 	if(ch->sample != NULL) {
+		#ifdef XM_SAMPLE_CACHE
+			if(!xm_sample_cache_fetch(ctx, ch->sample)) {
+				/* Waveform could not be loaded, pretend it is done playing */
+				ch->sample_position = -1;
+			}
+		#endif
+
 		if(!(flags & XM_TRIGGER_KEEP_VOLUME)) {
 			ch->volume = ch->sample->volume;
 		}
@@ -824,8 +892,7 @@ static void xm_trigger_note(xm_context_t* ctx, xm_channel_context_t* ch, unsigne
 	}
 
 	if(!(flags & XM_TRIGGER_KEEP_PERIOD)) {
-		ch->period = xm_period(ctx, ch->note);
-		xm_update_frequency(ctx, ch);
+		xm_note_period(ctx, ch);
 	}
 
 	ch->latest_trigger = ctx->generated_samples;
@@ -852,7 +919,63 @@ static void xm_key_off(xm_channel_context_t* ch) {
 	}
 }
 
+static xm_pattern_slot_t* xm_pattern_row(xm_context_t* ctx, uint8_t pattern, uint8_t row) {
+	xm_pattern_t* pat = ctx->module.patterns + pattern;
+
+	#ifdef XM_PACKED_PATTERNS
+		if(pattern == ctx->row_cache_pattern && row + 1 == ctx->row_cache_row) {
+			/* Row is already unpacked */
+			return ctx->row_cache;
+		}
+
+		if(pattern != ctx->row_cache_pattern || row < ctx->row_cache_row) {
+			/* Rows can only be found by unpacking from the start of
+			 * the pattern. Only happens after a jump or a loop. */
+			ctx->row_cache_pattern = pattern;
+			ctx->row_cache_row = 0;
+			ctx->row_cache_offset = 0;
+		}
+
+		while(ctx->row_cache_row <= row) {
+			ctx->row_cache_offset = xm_unpack_row(pat->packed, pat->packed_size, ctx->row_cache_offset,
+			                                      ctx->row_cache, ctx->module.num_channels);
+			ctx->row_cache_row++;
+		}
+
+		return ctx->row_cache;
+	#else
+		return pat->slots + row * ctx->module.num_channels;
+	#endif
+}
+
+/* Whether a jump scheduled by xm_schedule_jump() is made at the row
+ * xm_row() is about to play */
+static bool xm_scheduled_jump_due(xm_context_t* ctx) {
+	/* An E6y loop jumps back inside its pattern, which is no boundary */
+	bool boundary = ctx->current_row == 0 || ctx->pattern_break
+		|| (ctx->position_jump && (ctx->jump_dest != ctx->current_table_index || ctx->jump_row == 0));
+
+	if(boundary) return true;
+	return ctx->scheduled_rows > 0 && !ctx->position_jump
+		&& ctx->current_row % ctx->scheduled_rows == 0;
+}
+
 static void xm_row(xm_context_t* ctx) {
+	if(ctx->scheduled_jump && xm_scheduled_jump_due(ctx)) {
+		ctx->position_jump = true;
+		ctx->jump_dest = ctx->scheduled_dest;
+		ctx->jump_row = ctx->scheduled_row;
+		ctx->scheduled_jump = false;
+
+		/* Going back to a part already played is not the song looping */
+		memset(ctx->row_visited, 0, ROW_VISITED_BYTES(ctx->module.length, ctx->row_visited_stride));
+		if(ctx->scheduled_fade) {
+			for(uint8_t i = 0; i < ctx->module.num_channels; ++i) {
+				xm_cut_note(ctx->channels + i);
+			}
+		}
+	}
+
 	if(ctx->position_jump) {
 		ctx->current_table_index = ctx->jump_dest;
 		ctx->current_row = ctx->jump_row;
@@ -869,11 +992,12 @@ static void xm_row(xm_context_t* ctx) {
 	}
 
 	xm_pattern_t* cur = ctx->module.patterns + ctx->module.pattern_table[ctx->current_table_index];
+	xm_pattern_slot_t* row = xm_pattern_row(ctx, ctx->module.pattern_table[ctx->current_table_index], ctx->current_row);
 	bool in_a_loop = false;
 
 	/* Read notes… */
 	for(uint8_t i = 0; i < ctx->module.num_channels; ++i) {
-		xm_pattern_slot_t* s = cur->slots + ctx->current_row * ctx->module.num_channels + i;
+		xm_pattern_slot_t* s = row + i;
 		xm_channel_context_t* ch = ctx->channels + i;
 
 		ch->current = s;
@@ -889,9 +1013,19 @@ static void xm_row(xm_context_t* ctx) {
 		}
 	}
 
-	if(!in_a_loop) {
-		/* No E6y loop is in effect (or we are in the first pass) */
-		ctx->loop_count = (ctx->row_loop_count[MAX_NUM_ROWS * ctx->current_table_index + ctx->current_row]++);
+	if(!in_a_loop && ctx->current_row < ctx->row_visited_stride
+	   && ctx->current_table_index < ctx->module.length) {
+		/* No E6y loop is in effect (or we are in the first pass). A
+		 * restart position past the song length has no bits. */
+		size_t bit = (size_t)ctx->row_visited_stride * ctx->current_table_index + ctx->current_row;
+
+		if(ctx->row_visited[bit >> 3] & (1 << (bit & 7))) {
+			/* Been here before, the module looped. Start afresh so
+			 * that the next loop is detected the same way. */
+			ctx->loop_count++;
+			memset(ctx->row_visited, 0, ROW_VISITED_BYTES(ctx->module.length, ctx->row_visited_stride));
+		}
+		ctx->row_visited[bit >> 3] |= (1 << (bit & 7));
 	}
 
 	ctx->current_row++; /* Since this is an uint8, this line can
@@ -909,6 +1043,35 @@ static void xm_row(xm_context_t* ctx) {
 	}
 }
 
+static float xm_envelope_value(xm_envelope_t* env, uint16_t counter) {
+	uint8_t j;
+
+	#ifdef XM_BAKED_TABLES
+		if(env->baked != NULL && counter <= env->points[env->num_points - 1].frame) {
+			return env->baked[counter];
+		}
+	#endif
+
+	for(j = 0; j < (env->num_points - 2); ++j) {
+		if(env->points[j].frame <= counter &&
+		   env->points[j+1].frame >= counter) {
+			break;
+		}
+	}
+
+	return xm_envelope_lerp(env->points + j, env->points + j + 1, counter) / (float)0x40;
+}
+
+#ifdef XM_BAKED_TABLES
+void xm_bake_envelope(xm_envelope_t* env, float* table) {
+	uint16_t frames = env->points[env->num_points - 1].frame + 1;
+
+	for(uint16_t counter = 0; counter < frames; ++counter) {
+		table[counter] = xm_envelope_value(env, counter);
+	}
+}
+#endif
+
 static void xm_envelope_tick(xm_channel_context_t* ch,
 							 xm_envelope_t* env,
 							 uint16_t* counter,
@@ -925,8 +1088,6 @@ static void xm_envelope_tick(xm_channel_context_t* ch,
 
 		return;
 	} else {
-		uint8_t j;
-
 		if(env->loop_enabled) {
 			uint16_t loop_start = env->points[env->loop_start_point].frame;
 			uint16_t loop_end = env->points[env->loop_end_point].frame;
@@ -937,14 +1098,7 @@ static void xm_envelope_tick(xm_channel_context_t* ch,
 			}
 		}
 
-		for(j = 0; j < (env->num_points - 2); ++j) {
-			if(env->points[j].frame <= *counter &&
-			   env->points[j+1].frame >= *counter) {
-				break;
-			}
-		}
-
-		*outval = xm_envelope_lerp(env->points + j, env->points + j + 1, *counter) / (float)0x40;
+		*outval = xm_envelope_value(env, *counter);
 
 		/* Make sure it is safe to increment frame count */
 		if(!ch->sustained || !env->sustain_enabled ||
@@ -978,11 +1132,21 @@ static void xm_envelopes(xm_channel_context_t* ch) {
 }
 
 static void xm_tick(xm_context_t* ctx) {
+	for(uint8_t i = 0; i < XM_MIXED_CHANNELS(ctx); ++i) {
+		xm_channel_context_t* ch = ctx->channels + i;
+
+		if(ch->dropped) {
+			xm_skip_sample(ch, ctx->tick_frames);
+			ch->dropped = false;
+		}
+	}
+	ctx->tick_frames = 0;
+
 	if(ctx->current_tick == 0) {
 		xm_row(ctx);
 	}
 
-	for(uint8_t i = 0; i < ctx->module.num_channels; ++i) {
+	for(uint8_t i = 0; i < XM_MIXED_CHANNELS(ctx); ++i) {
 		xm_channel_context_t* ch = ctx->channels + i;
 
 		xm_envelopes(ch);
@@ -1217,10 +1381,15 @@ static void xm_tick(xm_context_t* ctx) {
 		#ifdef XM_RAMPING
 			ch->target_panning = panning;
 			ch->target_volume = volume;
-		#else
+		#endif
+		if(!XM_RAMPING_ON(ctx)) {
 			ch->actual_panning = panning;
 			ch->actual_volume = volume;
-		#endif
+		}
+	}
+
+	if(ctx->max_mixed_channels > 0 && ctx->max_mixed_channels < XM_MIXED_CHANNELS(ctx)) {
+		xm_drop_quietest(ctx);
 	}
 
 	ctx->current_tick++;
@@ -1233,14 +1402,72 @@ static void xm_tick(xm_context_t* ctx) {
 	ctx->remaining_samples_in_tick += (float)ctx->rate / ((float)ctx->bpm * 0.4f);
 }
 
-static float xm_sample_at(xm_sample_t* sample, size_t k) {
+#ifdef XM_ADPCM_SAMPLES
+/* ADPCM waveforms are decoded one block at a time into the channel. The
+ * first sample of a block is stored as is, so reading one sample past the
+ * end of the decoded block (for interpolation) costs nothing. */
+static float xm_adpcm_sample_at(xm_channel_context_t* ch, uint32_t k) {
+	uint32_t first, count, block;
+	const uint8_t* data;
+
+	if(ch->adpcm_sample == ch->sample && k - ch->adpcm_first < ch->adpcm_count) {
+		return ch->adpcm_buffer[k - ch->adpcm_first] / 32768.f;
+	}
+
+	block = xm_adpcm_block_of(ch->sample, k, &first, &count);
+	data = (const uint8_t*)ch->sample->data8 + block * XM_ADPCM_BLOCK_BYTES;
+	if(k == first) {
+		return xm_adpcm_first(data) / 32768.f;
+	}
+
+	xm_adpcm_decode_block(data, ch->adpcm_buffer);
+	ch->adpcm_sample = ch->sample;
+	ch->adpcm_first = first;
+	ch->adpcm_count = count;
+	return ch->adpcm_buffer[k - first] / 32768.f;
+}
+#endif
+
+#ifdef XM_LIBXMIZE_DELTA_SAMPLES
+/* Delta encoded waveforms of shared contexts are decoded one block at a
+ * time into the channel, like ADPCM. Each block starts from its keyframe,
+ * so reading the first sample of the next block costs nothing. */
+static float xm_delta_sample_at(xm_channel_context_t* ch, uint32_t k) {
+	uint32_t first, count, block;
+
+	if(ch->delta_sample == ch->sample && k - ch->delta_first < ch->delta_count) {
+		return ch->delta_buffer[k - ch->delta_first] / 32768.f;
+	}
+
+	block = xm_delta_block_of(ch->sample, k, &first, &count);
+	if(k == first) {
+		return xm_delta_keyframe(ch->sample, block) / 32768.f;
+	}
+
+	xm_delta_decode_block(ch->sample, block, first, count, ch->delta_buffer);
+	ch->delta_sample = ch->sample;
+	ch->delta_first = first;
+	ch->delta_count = count;
+	return ch->delta_buffer[k - first] / 32768.f;
+}
+#endif
+
+static float xm_sample_at(xm_channel_context_t* ch, size_t k) {
+	xm_sample_t* sample = ch->sample;
+	#ifdef XM_ADPCM_SAMPLES
+		if(sample->adpcm) return xm_adpcm_sample_at(ch, k);
+	#endif
+	#ifdef XM_LIBXMIZE_DELTA_SAMPLES
+		if(sample->delta) return xm_delta_sample_at(ch, k);
+	#endif
 	return sample->bits == 8 ? (sample->data8[k] / 128.f) : (sample->data16[k] / 32768.f);
 }
 
-static float xm_next_of_sample(xm_channel_context_t* ch) {
-	if(ch->instrument == NULL || ch->sample == NULL || ch->sample_position < 0) {
+static float xm_next_of_sample(xm_context_t* ctx, xm_channel_context_t* ch) {
+	if(ch->instrument == NULL || ch->sample == NULL || ch->sample_position < 0
+	   || !XM_SAMPLE_LOADED(ch->sample)) {
 		#ifdef XM_RAMPING
-			if(ch->frame_count < XM_SAMPLE_RAMPING_POINTS) {
+			if(XM_RAMPING_ON(ctx) && ch->frame_count < XM_SAMPLE_RAMPING_POINTS) {
 				return XM_LERP(ch->end_of_previous_sample[ch->frame_count], .0f,
 							   (float)ch->frame_count / (float)XM_SAMPLE_RAMPING_POINTS);
 			}
@@ -1251,23 +1478,22 @@ static float xm_next_of_sample(xm_channel_context_t* ch) {
 		return .0f;
 	}
 
-	float u, v, t;
+	float u, v = .0f, t;
 	uint32_t a = (uint32_t)ch->sample_position; /* This cast is fine,
 												* sample_position will not
 												* go above integer
 												* ranges */
-	#ifdef XM_LINEAR_INTERPOLATION
-		uint32_t b = a + 1;
-		t = ch->sample_position - a; /* Cheaper than fmodf(., 1.f) */
-	#endif
-	u = xm_sample_at(ch->sample, a);
+	const bool lerp = XM_INTERPOLATION_ON(ctx);
+	uint32_t b = a + 1;
+	t = ch->sample_position - a; /* Cheaper than fmodf(., 1.f) */
+	u = xm_sample_at(ch, a);
 
 	switch(ch->sample->loop_type) {
 
 		case XM_NO_LOOP:
-			#ifdef XM_LINEAR_INTERPOLATION
-				v = (b < ch->sample->length) ? xm_sample_at(ch->sample, b) : .0f;
-			#endif
+			if(lerp) {
+				v = (b < ch->sample->length) ? xm_sample_at(ch, b) : .0f;
+			}
 			ch->sample_position += ch->step;
 			if(ch->sample_position >= ch->sample->length) {
 				ch->sample_position = -1;
@@ -1275,12 +1501,12 @@ static float xm_next_of_sample(xm_channel_context_t* ch) {
 			break;
 
 		case XM_FORWARD_LOOP:
-			#ifdef XM_LINEAR_INTERPOLATION
+			if(lerp) {
 				v = xm_sample_at(
-					ch->sample,
+					ch,
 					(b == ch->sample->loop_end) ? ch->sample->loop_start : b
 					);
-			#endif
+			}
 			ch->sample_position += ch->step;
 			while(ch->sample_position >= ch->sample->loop_end) {
 				ch->sample_position -= ch->sample->loop_length;
@@ -1296,9 +1522,9 @@ static float xm_next_of_sample(xm_channel_context_t* ch) {
 			/* XXX: this may not work for very tight ping-pong loops
 			 * (ie switches direction more than once per sample */
 			if(ch->ping) {
-				#ifdef XM_LINEAR_INTERPOLATION
-					v = xm_sample_at(ch->sample, (b >= ch->sample->loop_end) ? a : b);
-				#endif
+				if(lerp) {
+					v = xm_sample_at(ch, (b >= ch->sample->loop_end) ? a : b);
+				}
 				if(ch->sample_position >= ch->sample->loop_end) {
 					ch->ping = false;
 					ch->sample_position = (ch->sample->loop_end << 1) - ch->sample_position;
@@ -1309,13 +1535,13 @@ static float xm_next_of_sample(xm_channel_context_t* ch) {
 					ch->sample_position -= ch->sample->length - 1;
 				}
 			} else {
-				#ifdef XM_LINEAR_INTERPOLATION
+				if(lerp) {
 					v = u;
 					u = xm_sample_at(
-						ch->sample,
+						ch,
 						(b == 1 || b - 2 <= ch->sample->loop_start) ? a : (b - 2)
 						);
-				#endif
+				}
 				if(ch->sample_position <= ch->sample->loop_start) {
 					ch->ping = true;
 					ch->sample_position = (ch->sample->loop_start << 1) - ch->sample_position;
@@ -1333,14 +1559,10 @@ static float xm_next_of_sample(xm_channel_context_t* ch) {
 			break;
 	}
 
-	#ifdef XM_LINEAR_INTERPOLATION
-		float endval = XM_LERP(u, v, t);
-	#else
-		float endval = u;
-	#endif
+	float endval = lerp ? XM_LERP(u, v, t) : u;
 	
 	#ifdef XM_RAMPING
-		if(ch->frame_count < XM_SAMPLE_RAMPING_POINTS) {
+		if(XM_RAMPING_ON(ctx) && ch->frame_count < XM_SAMPLE_RAMPING_POINTS) {
 			/* Smoothly transition between old and new sample. */
 			return XM_LERP(ch->end_of_previous_sample[ch->frame_count], endval,
 						   (float)ch->frame_count / (float)XM_SAMPLE_RAMPING_POINTS);
@@ -1350,11 +1572,97 @@ static float xm_next_of_sample(xm_channel_context_t* ch) {
 	return endval;
 }
 
+/* Move a channel that was not mixed on by frames, as xm_next_of_sample()
+ * would have, without reading the waveform */
+static void xm_skip_sample(xm_channel_context_t* ch, uint32_t frames) {
+	if(ch->instrument == NULL || ch->sample == NULL || ch->sample_position < 0
+	   || ch->sample->length == 0) {
+		return;
+	}
+
+	xm_sample_t* sample = ch->sample;
+	float distance = ch->step * frames;
+	float loop_length = (float)sample->loop_length;
+
+	if(sample->loop_type == XM_PING_PONG_LOOP && loop_length > 0) {
+		/* Unfold the loop into one cycle of twice its length, played
+		 * forwards from loop_start */
+		float unfolded;
+
+		if(ch->ping) {
+			if(ch->sample_position + distance < sample->loop_end) {
+				ch->sample_position += distance;
+				return;
+			}
+			unfolded = ch->sample_position - sample->loop_start + distance;
+		} else {
+			unfolded = 2.f * loop_length - (ch->sample_position - sample->loop_start) + distance;
+		}
+		unfolded = fmodf(unfolded, 2.f * loop_length);
+		ch->ping = (unfolded < loop_length);
+		ch->sample_position = sample->loop_start
+			+ (ch->ping ? unfolded : 2.f * loop_length - unfolded);
+	} else if(sample->loop_type == XM_FORWARD_LOOP && loop_length > 0) {
+		ch->sample_position += distance;
+		if(ch->sample_position >= sample->loop_end) {
+			ch->sample_position = sample->loop_start
+				+ fmodf(ch->sample_position - sample->loop_start, loop_length);
+		}
+	} else {
+		ch->sample_position += distance;
+		if(ch->sample_position >= sample->length) {
+			ch->sample_position = -1;
+		}
+	}
+}
+
+/* How loud a channel is for xm_drop_quietest(), negative if it is not
+ * playing at all */
+static float xm_loudness(xm_channel_context_t* ch) {
+	if(ch->instrument == NULL || ch->sample == NULL || ch->sample_position < 0
+	   || !XM_SAMPLE_LOADED(ch->sample)) {
+		return -1.f;
+	}
+	if(ch->muted || ch->instrument->muted) {
+		return .0f;
+	}
+	#ifdef XM_RAMPING
+		/* Where the volume is going, so a note fading in counts */
+		return ch->target_volume > ch->actual_volume ? ch->target_volume : ch->actual_volume;
+	#else
+		return ch->actual_volume;
+	#endif
+}
+
+/* Mark all but the max_mixed_channels loudest channels as dropped for
+ * this tick. Ties go to the lower channel, so the choice is stable. */
+static void xm_drop_quietest(xm_context_t* ctx) {
+	uint8_t n = XM_MIXED_CHANNELS(ctx);
+
+	for(uint8_t i = 0; i < n; ++i) {
+		xm_channel_context_t* ch = ctx->channels + i;
+		float loudness = xm_loudness(ch);
+		uint8_t louder = 0;
+
+		if(loudness < .0f) {
+			continue;
+		}
+		for(uint8_t j = 0; j < n && louder < ctx->max_mixed_channels; ++j) {
+			float other = xm_loudness(ctx->channels + j);
+			if(other > loudness || (other == loudness && j < i)) {
+				++louder;
+			}
+		}
+		ch->dropped = (louder >= ctx->max_mixed_channels);
+	}
+}
+
 static void xm_sample(xm_context_t* ctx, float* left, float* right) {
 	if(ctx->remaining_samples_in_tick <= 0) {
 		xm_tick(ctx);
 	}
 	ctx->remaining_samples_in_tick--;
+	ctx->tick_frames++;
 
 	*left = 0.f;
 	*right = 0.f;
@@ -1363,14 +1671,15 @@ static void xm_sample(xm_context_t* ctx, float* left, float* right) {
 		return;
 	}
 
-	for(uint8_t i = 0; i < ctx->module.num_channels; ++i) {
+	for(uint8_t i = 0; i < XM_MIXED_CHANNELS(ctx); ++i) {
 		xm_channel_context_t* ch = ctx->channels + i;
 
-		if(ch->instrument == NULL || ch->sample == NULL || ch->sample_position < 0) {
+		if(ch->instrument == NULL || ch->sample == NULL || ch->sample_position < 0
+		   || !XM_SAMPLE_LOADED(ch->sample) || ch->dropped) {
 			continue;
 		}
 
-		const float fval = xm_next_of_sample(ch);
+		const float fval = xm_next_of_sample(ctx, ch);
 		
 		if(!ch->muted && !ch->instrument->muted) {
 			*left += fval * ch->actual_volume * (1.f - ch->actual_panning);
@@ -1378,9 +1687,11 @@ static void xm_sample(xm_context_t* ctx, float* left, float* right) {
 		}
 
 		#ifdef XM_RAMPING
-			ch->frame_count++;
-			XM_SLIDE_TOWARDS(ch->actual_volume, ch->target_volume, ctx->volume_ramp);
-			XM_SLIDE_TOWARDS(ch->actual_panning, ch->target_panning, ctx->panning_ramp);
+			if(XM_RAMPING_ON(ctx)) {
+				ch->frame_count++;
+				XM_SLIDE_TOWARDS(ch->actual_volume, ch->target_volume, ctx->volume_ramp);
+				XM_SLIDE_TOWARDS(ch->actual_panning, ch->target_panning, ctx->panning_ramp);
+			}
 		#endif
 	}
 	const float fgvol = ctx->global_volume * ctx->amplification;
@@ -1403,6 +1714,71 @@ void xm_generate_samples(xm_context_t* ctx, float* output, size_t numsamples) {
 	}
 }
 
+void xm_mix_samples(xm_context_t* ctx, float* output, size_t numsamples, float gain) {
+	float left, right;
+
+	ctx->generated_samples += numsamples;
+
+	for(size_t i = 0; i < numsamples; i++) {
+		xm_sample(ctx, &left, &right);
+		output[2 * i] += left * gain;
+		output[2 * i + 1] += right * gain;
+	}
+}
+
+#ifdef XM_SFX_VOICES
+/* Whether a voice has nothing left to play */
+static bool xm_voice_is_free(const xm_channel_context_t* ch) {
+	return ch->instrument == NULL || ch->sample == NULL || ch->sample_position < 0
+		|| !XM_SAMPLE_LOADED(ch->sample) || ch->volume <= 0.f
+		|| (!ch->sustained && ch->fadeout_volume * ch->volume_envelope_volume <= 0.f);
+}
+
+int8_t xm_trigger_voice(xm_context_t* ctx, uint16_t instrument, uint8_t note, float volume, float panning, uint8_t priority) {
+	xm_channel_context_t* voices = ctx->channels + ctx->module.num_channels;
+	xm_pattern_slot_t s = { 0 };
+	int8_t v = -1;
+
+	if(instrument == 0 || instrument > ctx->module.num_instruments || !NOTE_IS_VALID(note)) {
+		return -1;
+	}
+
+	/* A free voice, or else the lowest priority one that started first */
+	for(uint8_t i = 0; i < ctx->num_voices; ++i) {
+		if(xm_voice_is_free(voices + i)) {
+			v = i;
+			break;
+		}
+		if(ctx->voice_priority[i] > priority) continue;
+		if(v < 0 || ctx->voice_priority[i] < ctx->voice_priority[v]
+		   || (ctx->voice_priority[i] == ctx->voice_priority[v]
+		       && voices[i].latest_trigger < voices[v].latest_trigger)) {
+			v = i;
+		}
+	}
+	if(v < 0) return -1;
+
+	s.note = note;
+	s.instrument = (uint8_t)instrument;
+	xm_handle_note_and_instrument(ctx, voices + v, &s);
+	if(voices[v].sample == NULL) return -1;
+
+	voices[v].volume *= volume;
+	XM_CLAMP(voices[v].volume);
+	if(panning >= 0.f) {
+		voices[v].panning = panning;
+		XM_CLAMP(voices[v].panning);
+	}
+	ctx->voice_priority[v] = priority;
+	return v;
+}
+
+void xm_release_voice(xm_context_t* ctx, int8_t voice) {
+	if(voice < 0 || voice >= ctx->num_voices) return;
+	xm_key_off(ctx->channels + ctx->module.num_channels + voice);
+}
+#endif
+
 #ifdef XM_DEBUG
 	void xm_set_debug( char state ){
 		xm_debugmode = state;
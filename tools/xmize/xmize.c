@@ -0,0 +1,342 @@
+/* Author: Peter "Projectitis" Vullings <peter@projectitis.com> */
+
+/* This program is free software. It comes without any warranty, to the
+ * extent permitted by applicable law. You can redistribute it and/or
+ * modify it under the terms of the Do What The Fuck You Want To Public
+ * License, Version 2, as published by Sam Hocevar. See
+ * http://sam.zoy.org/wtfpl/COPYING for more details. */
+
+/**
+ * Convert XM modules to libxmized images on a PC, ready to include in a
+ * Teensy sketch and load with xm_player_xmize().
+ *
+ * Build on Linux or macOS from this folder with:
+ *
+ *    cc -O2 -I../.. -o xmize xmize.c ../../[a-z]*.c -lm -lpthread
+ *
+ * Images depend on the settings in xm.h, so build with the same xm.h as
+ * the sketch that will load them.
+ **/
+
+#include "xm.h"
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#ifndef XM_HAS_MMAP
+	#error "xmize needs a POSIX host"
+#endif
+
+void xm_stdout( const char *str ){
+	fputs(str, stderr);
+}
+
+void xm_delay( uint32_t ms ){
+	usleep(ms * 1000);
+}
+
+static const char* usage =
+	"Usage: xmize [-o dir] [-b] [-n] [-s] [-k bank] [-j jobs] file.xm|dir ...\n"
+	"  -o dir   write output to dir instead of next to each module\n"
+	"  -b       write binary .xmize images instead of _libxmize.h headers\n"
+	"  -n       use the layout of this machine instead of the Teensy's\n"
+	"  -s       strip data the song never plays (see xm_strip_context)\n"
+	"  -k bank  write all modules into one bank sharing their samples, named\n"
+	"           bank_libxmize.h (or bank.xmize), in the order given\n"
+	"  -j jobs  number of modules to convert at once (default: all CPUs)\n"
+	"Directories are searched for .xm files.\n";
+
+static const char* outdir = NULL;
+static bool binary = false;
+static bool strip = false;
+static const char* bank = NULL;
+static xm_libxmize_target_t target = XM_TARGET_ARM32;
+
+static char** files = NULL;
+static size_t num_files = 0;
+static size_t next_file = 0;
+static size_t num_failed = 0;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static const char* errors[] = { "ok", "not a valid module", "out of memory", "write failed" };
+
+static void add_file(const char* path) {
+	files = realloc(files, (num_files + 1) * sizeof(char*));
+	files[num_files++] = strdup(path);
+}
+
+static void add_dir(const char* path) {
+	DIR* dir = opendir(path);
+	struct dirent* ent;
+
+	if(dir == NULL) {
+		fprintf(stderr, "%s: cannot open directory\n", path);
+		num_failed++;
+		return;
+	}
+	while((ent = readdir(dir)) != NULL) {
+		size_t len = strlen(ent->d_name);
+		char full[4096];
+
+		if(len < 4 || strcasecmp(ent->d_name + len - 3, ".xm") != 0) continue;
+		snprintf(full, sizeof(full), "%s/%s", path, ent->d_name);
+		add_file(full);
+	}
+	closedir(dir);
+}
+
+/* Output path and C identifier for a module, e.g. dir/shooting_star.xm
+ * gives outdir/shooting_star_libxmize.h and shooting_star_libxmize */
+static void output_names(const char* path, char* out, size_t outlen, char* name, size_t namelen) {
+	const char* base = strrchr(path, '/');
+	size_t dirlen = base ? (size_t)(base - path) : 0;
+	size_t baselen, i;
+
+	base = base ? base + 1 : path;
+	baselen = strcspn(base, ".");
+
+	snprintf(name, namelen, "%s%.*s_libxmize", isdigit((unsigned char)base[0]) ? "_" : "", (int)baselen, base);
+	for(i = 0; name[i]; ++i) {
+		if(!isalnum((unsigned char)name[i])) name[i] = '_';
+	}
+
+	if(outdir) {
+		snprintf(out, outlen, "%s/%.*s", outdir, (int)baselen, base);
+	} else {
+		snprintf(out, outlen, "%.*s%s%.*s", (int)dirlen, path, dirlen ? "/" : "", (int)baselen, base);
+	}
+	strncat(out, binary ? ".xmize" : "_libxmize.h", outlen - strlen(out) - 1);
+}
+
+static void header_comment(FILE* f) {
+	#if defined(XM_ADPCM_SAMPLES)
+		fputs("// module data in libxmized format with ADPCM samples\n", f);
+	#elif defined(XM_LIBXMIZE_DELTA_SAMPLES)
+		fputs("// module data in libxmized format with delta-encoded samples\n", f);
+	#else
+		fputs("// module data in libxmized format without delta-encoded samples\n", f);
+	#endif
+}
+
+/* Create the context of a module, stripping it if asked to */
+static int load_module(xm_context_t** ctxp, const char* data, size_t length, xm_strip_stats_t* strip_stats) {
+	int ret;
+
+	if((ret = xm_create_context_safe(ctxp, data, length, 48000))) {
+		return ret;
+	}
+	if(strip && (ret = xm_strip_context(*ctxp, strip_stats))) {
+		xm_free_context(*ctxp);
+		*ctxp = NULL;
+	}
+	return ret;
+}
+
+/* Write the image of a module, stripping it first if asked to */
+static int write_image(const char* data, size_t length, xm_write_func_t write, void* user,
+                       xm_libxmize_stats_t* stats, xm_strip_stats_t* strip_stats) {
+	xm_context_t* ctx;
+	int ret;
+
+	if(!strip) {
+		return xm_libxmize_write(data, length, target, write, user, stats);
+	}
+
+	if((ret = load_module(&ctx, data, length, strip_stats))) {
+		return ret;
+	}
+	ret = xm_libxmize_context(ctx, target, write, user, stats);
+	xm_free_context(ctx);
+	return ret;
+}
+
+static int convert(const char* path, const char* out, const char* name, xm_libxmize_stats_t* stats,
+                   xm_strip_stats_t* strip_stats) {
+	xm_mapped_module_t* map;
+	xm_header_writer_t hw;
+	const char* data;
+	size_t length;
+	FILE* f;
+	int ret;
+
+	if((ret = xm_map_module(&map, path))) {
+		return ret;
+	}
+	data = xm_get_mapped_data(map, &length);
+
+	f = fopen(out, binary ? "wb" : "w");
+	if(f == NULL) {
+		xm_unmap_module(map);
+		return 3;
+	}
+
+	if(binary) {
+		ret = write_image(data, length, xm_write_to_file, f, stats, strip_stats);
+	} else {
+		header_comment(f);
+		ret = !xm_header_begin(&hw, name, xm_write_to_file, f) ? 3
+			: write_image(data, length, xm_header_write, &hw, stats, strip_stats);
+		if(ret == 0 && !xm_header_end(&hw)) ret = 3;
+	}
+
+	if(fclose(f) != 0 && ret == 0) ret = 3;
+	if(ret) remove(out);
+
+	xm_unmap_module(map);
+	return ret;
+}
+
+static void* worker(void* arg) {
+	(void)arg;
+
+	for(;;) {
+		char out[4096], name[256];
+		xm_libxmize_stats_t stats;
+		xm_strip_stats_t strip_stats;
+		size_t i;
+		int ret;
+
+		pthread_mutex_lock(&lock);
+		i = next_file++;
+		pthread_mutex_unlock(&lock);
+		if(i >= num_files) break;
+
+		output_names(files[i], out, sizeof(out), name, sizeof(name));
+		ret = convert(files[i], out, name, &stats, &strip_stats);
+
+		pthread_mutex_lock(&lock);
+		if(ret) {
+			fprintf(stderr, "%s: %s\n", files[i], errors[ret > 3 ? 1 : ret]);
+			num_failed++;
+		} else {
+			printf("%s -> %s (%zu bytes", files[i], out, stats.image_size);
+			if(stats.saved_bytes) {
+				printf(", saved %zu storing %u samples and %u patterns once",
+				       stats.saved_bytes, stats.shared_samples, stats.shared_patterns);
+			}
+			if(strip && strip_stats.saved_bytes) {
+				printf(", stripped %zu removing %u patterns, %u instruments, %u samples, %u channels",
+				       strip_stats.saved_bytes, strip_stats.patterns, strip_stats.instruments,
+				       strip_stats.samples, strip_stats.channels);
+			}
+			printf(")\n");
+		}
+		pthread_mutex_unlock(&lock);
+	}
+	return NULL;
+}
+
+/* Write all modules into one bank, in the order they were given */
+static int convert_bank(void) {
+	xm_context_t** ctxs = calloc(num_files, sizeof(xm_context_t*));
+	xm_libxmize_stats_t stats;
+	xm_header_writer_t hw;
+	char out[4096], name[256];
+	size_t i;
+	FILE* f;
+	int ret = 0;
+
+	if(ctxs == NULL || num_files > UINT16_MAX) {
+		fprintf(stderr, "%s: too many modules\n", bank);
+		free(ctxs);
+		return 1;
+	}
+
+	for(i = 0; i < num_files && ret == 0; ++i) {
+		xm_mapped_module_t* map;
+		xm_strip_stats_t strip_stats;
+		const char* data;
+		size_t length;
+
+		if((ret = xm_map_module(&map, files[i])) == 0) {
+			data = xm_get_mapped_data(map, &length);
+			ret = load_module(ctxs + i, data, length, &strip_stats);
+			xm_unmap_module(map);
+		}
+		if(ret) {
+			fprintf(stderr, "%s: %s\n", files[i], errors[ret > 3 ? 1 : ret]);
+		}
+	}
+
+	if(ret == 0) {
+		output_names(bank, out, sizeof(out), name, sizeof(name));
+		f = fopen(out, binary ? "wb" : "w");
+		if(f == NULL) {
+			ret = 3;
+		} else if(binary) {
+			ret = xm_libxmize_bank(ctxs, (uint16_t)num_files, target, xm_write_to_file, f, &stats);
+		} else {
+			header_comment(f);
+			ret = !xm_header_begin(&hw, name, xm_write_to_file, f) ? 3
+				: xm_libxmize_bank(ctxs, (uint16_t)num_files, target, xm_header_write, &hw, &stats);
+			if(ret == 0 && !xm_header_end(&hw)) ret = 3;
+		}
+		if(f != NULL && fclose(f) != 0 && ret == 0) ret = 3;
+
+		if(ret) {
+			if(f != NULL) remove(out);
+			fprintf(stderr, "%s: %s\n", out, errors[ret > 3 ? 1 : ret]);
+		} else {
+			printf("%zu modules -> %s (%zu bytes, saved %zu storing %u samples and %u patterns once)\n",
+			       num_files, out, stats.image_size, stats.saved_bytes, stats.shared_samples, stats.shared_patterns);
+		}
+	}
+
+	for(i = 0; i < num_files; ++i) {
+		if(ctxs[i]) xm_free_context(ctxs[i]);
+	}
+	free(ctxs);
+	return ret ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+	long jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	pthread_t* threads;
+	struct stat st;
+	int opt;
+
+	while((opt = getopt(argc, argv, "o:bnsk:j:h")) != -1) {
+		switch(opt) {
+		case 'o': outdir = optarg; break;
+		case 'b': binary = true; break;
+		case 'n': target = XM_TARGET_NATIVE; break;
+		case 's': strip = true; break;
+		case 'k': bank = optarg; break;
+		case 'j': jobs = atol(optarg); break;
+		default: fputs(usage, stderr); return 1;
+		}
+	}
+	if(optind >= argc) {
+		fputs(usage, stderr);
+		return 1;
+	}
+
+	for(int i = optind; i < argc; ++i) {
+		if(stat(argv[i], &st) == 0 && S_ISDIR(st.st_mode)) {
+			add_dir(argv[i]);
+		} else {
+			add_file(argv[i]);
+		}
+	}
+
+	if(bank) {
+		return (num_failed || !num_files) ? 1 : convert_bank();
+	}
+
+	if(jobs < 1) jobs = 1;
+	if((size_t)jobs > num_files) jobs = num_files ? (long)num_files : 1;
+	threads = malloc(jobs * sizeof(pthread_t));
+	for(long i = 0; i < jobs; ++i) {
+		pthread_create(threads + i, NULL, worker, NULL);
+	}
+	for(long i = 0; i < jobs; ++i) {
+		pthread_join(threads[i], NULL);
+	}
+
+	free(threads);
+	return num_failed ? 1 : 0;
+}
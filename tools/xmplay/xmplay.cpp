@@ -0,0 +1,204 @@
+/* Author: Peter "Projectitis" Vullings <peter@projectitis.com> */
+
+/* This program is free software. It comes without any warranty, to the
+ * extent permitted by applicable law. You can redistribute it and/or
+ * modify it under the terms of the Do What The Fuck You Want To Public
+ * License, Version 2, as published by Sam Hocevar. See
+ * http://sam.zoy.org/wtfpl/COPYING for more details. */
+
+/**
+ * Run the player on a PC through one of the host outputs, to measure how
+ * it keeps up without a Teensy.
+ *
+ * Build on Linux or macOS from this folder with:
+ *
+ *    cc -O2 -I../.. -c ../../[a-z]*.c
+ *    c++ -O2 -I../.. -o xmplay xmplay.cpp ../../xm_player.cpp ../../xm_output_host.cpp *.o -lm -lpthread
+ *
+ * As with xmize, build with the same xm.h as the images it plays.
+ **/
+
+#include "xm_player.h"
+#include <stdio.h>
+#include <unistd.h>
+#include <chrono>
+#include <thread>
+
+#ifndef XM_HAS_MMAP
+	#error "xmplay needs a POSIX host"
+#endif
+
+extern "C" void xm_stdout( const char *str ){
+	fputs(str, stderr);
+}
+
+extern "C" void xm_delay( uint32_t ms ){
+	usleep(ms * 1000);
+}
+
+extern "C" uint32_t xm_micros( void ){
+	return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static const char* usage =
+	"Usage: xmplay [-w file.wav | -p period_us] [-r rate] [-b frames] [-f free] [-c chunk]\n"
+	"              [-m frames] [-B us] [-u loop_us] [-g fill,load] [-t seconds] [-x ms]\n"
+	"              file.xm|file.xmize ...\n"
+	"  -w file  write the output to a WAV file as fast as the player renders it\n"
+	"  -p us    take frames in real time every period_us, like a DAC interrupt\n"
+	"           (default: drop frames as fast as the player renders them)\n"
+	"  -r rate  output rate in Hz (default: 48000)\n"
+	"  -b n     buffer n frames (default: rate / 480)\n"
+	"  -f n     render only when at least n frames of the buffer are free\n"
+	"  -c n     render at most n frames per call to the mixer\n"
+	"  -m n     render at most n frames per update\n"
+	"  -B us    stop rendering after us microseconds per update\n"
+	"  -u us    sleep this long between updates, as other work in loop() would\n"
+	"  -g f,l   lower the quality when the buffer is less than f% full or rendering\n"
+	"           takes more than l% of real time, see xm_player_governor()\n"
+	"  -t secs  stop after this many seconds instead of when the first song loops\n"
+	"  -x ms    crossfade from the first module to the second over ms, starting\n"
+	"           at once\n"
+	"Each module is loaded into the next slot of the player and mixed with the\n"
+	"others.\n";
+
+static xm_mapped_module_t* maps[XM_PLAYER_CONTEXTS];
+
+static void cleanup(xm_output_t* output) {
+	xm_player_exit();
+	xm_output_free(output);
+	for(int i = 0; i < XM_PLAYER_CONTEXTS; ++i) {
+		if(maps[i]) xm_unmap_module(maps[i]);
+	}
+}
+
+int main(int argc, char** argv) {
+	const char* wav = NULL;
+	uint32_t period_us = 0, rate = 48000, loop_us = 0, budget_us = 0;
+	long max_frames = 0;
+	long frames = 0, threshold = 1, chunk = 0;
+	uint32_t fade_ms = 0;
+	unsigned low_fill = 0, max_load = 0;
+	bool governed = false;
+	double seconds = 0;
+	int num_modules;
+	xm_output_t output;
+	xm_player_stats_t stats;
+	uint64_t rendered = 0;
+	bool ok;
+	int opt;
+
+	while((opt = getopt(argc, argv, "w:p:r:b:f:c:m:B:u:g:t:x:h")) != -1) {
+		switch(opt) {
+		case 'w': wav = optarg; break;
+		case 'p': period_us = atol(optarg); break;
+		case 'r': rate = atol(optarg); break;
+		case 'b': frames = atol(optarg); break;
+		case 'f': threshold = atol(optarg); break;
+		case 'c': chunk = atol(optarg); break;
+		case 'm': max_frames = atol(optarg); break;
+		case 'B': budget_us = atol(optarg); break;
+		case 'u': loop_us = atol(optarg); break;
+		case 'g':
+			governed = sscanf(optarg, "%u,%u", &low_fill, &max_load) == 2
+				&& low_fill < 100 && max_load > 0 && max_load <= 255;
+			if(!governed) {
+				fputs(usage, stderr);
+				return 1;
+			}
+			break;
+		case 't': seconds = atof(optarg); break;
+		case 'x': fade_ms = atol(optarg); break;
+		default: fputs(usage, stderr); return 1;
+		}
+	}
+	num_modules = argc - optind;
+	if(num_modules < 1 || num_modules > XM_PLAYER_CONTEXTS || (wav && period_us)
+	   || (fade_ms && num_modules < 2)) {
+		fputs(usage, stderr);
+		return 1;
+	}
+
+	ok = wav ? xm_output_wav(&output, rate, wav)
+		: period_us ? xm_output_paced(&output, rate, period_us)
+		: xm_output_null(&output, rate);
+	if(!ok) {
+		fprintf(stderr, "%s: cannot create output\n", wav ? wav : "xmplay");
+		return 1;
+	}
+	xm_player_output(&output);
+	if(frames && !xm_player_buffer((uint16_t)frames, (uint16_t)threshold, (uint16_t)chunk)) {
+		fprintf(stderr, "xmplay: cannot buffer %ld frames\n", frames);
+		cleanup(&output);
+		return 1;
+	}
+
+	for(int i = 0; i < num_modules; ++i) {
+		const char* path = argv[optind + i];
+
+		if(xm_map_module(maps + i, path)) {
+			fprintf(stderr, "%s: cannot read module\n", path);
+			cleanup(&output);
+			return 1;
+		}
+		xm_player_mapped(maps[i], i);
+		if(!xm_player_context(i)) {
+			fprintf(stderr, "%s: not a valid module\n", path);
+			cleanup(&output);
+			return 1;
+		}
+	}
+	if(fade_ms) {
+		xm_player_gain(1, 0.0f);
+		xm_player_gain(0, 0.0f, fade_ms);
+		xm_player_gain(1, 1.0f, fade_ms);
+	}
+
+	if(governed) xm_player_governor(true, (uint8_t)low_fill, (uint8_t)max_load);
+
+	printf("Buffer latency %.1fms\n", xm_player_latency() / 1000.0);
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	double elapsed = 0;
+
+	xm_player_start();
+	while(seconds ? elapsed < seconds : !xm_get_loop_count(xm_player_context())) {
+		uint16_t n = (max_frames || budget_us) ? xm_player_update_budget((uint16_t)max_frames, budget_us)
+			: xm_player_update();
+
+		rendered += n;
+		if(loop_us) {
+			std::this_thread::sleep_for(std::chrono::microseconds(loop_us));
+		} else if(!n) {
+			std::this_thread::yield();
+		}
+		elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+	xm_player_stop();
+
+	xm_player_stats(&stats);
+	printf("%llu frames rendered, %llu output in %.3fs (%.1fx real time)\n",
+	       (unsigned long long)rendered, (unsigned long long)xm_output_frames(&output), elapsed,
+	       (double)xm_output_frames(&output) / rate / elapsed);
+	printf("%u updates, %u rendered, %u found the buffer full, %u used up their budget\n",
+	       stats.updates, stats.renders, stats.overruns, stats.yields);
+	printf("%u frames underran, %u frames lowest fill\n", stats.underruns, stats.min_fill);
+	printf("Render time %uus total, %uus longest, %.1fus average\n", stats.render_time, stats.max_render,
+	       stats.renders ? (double)stats.render_time / stats.renders : 0.0);
+	if(governed) {
+		printf("Quality level %u at the end, %u at worst, changed %u times\n", stats.level, stats.max_level,
+		       stats.level_changes);
+	}
+	printf("Time between updates, longest %uus:\n", stats.max_gap);
+	for(int i = 0; i < XM_PLAYER_GAP_BUCKETS; ++i) {
+		if(i < XM_PLAYER_GAP_BUCKETS - 1) {
+			printf("  < %6uus %u\n", 250u << i, stats.gaps[i]);
+		} else {
+			printf("  >= %5uus %u\n", 250u << (i - 1), stats.gaps[i]);
+		}
+	}
+
+	cleanup(&output);
+	return 0;
+}
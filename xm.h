@@ -18,6 +18,25 @@
 struct xm_context_s;
 typedef struct xm_context_s xm_context_t;
 
+/** Module metadata, as filled by xm_probe(). */
+struct xm_probe_s {
+	char module_name[21];
+	char tracker_name[21];
+	uint16_t length; /* In patterns */
+	uint16_t restart_position;
+	uint16_t num_channels;
+	uint16_t num_patterns;
+	uint16_t num_instruments;
+	uint16_t num_samples; /* Total, in all instruments */
+	uint16_t tempo;
+	uint16_t bpm;
+	bool linear_frequencies;
+	uint32_t total_rows; /* Sum of the rows of all patterns */
+	uint32_t sample_data_size; /* Total size of sample data, in bytes */
+	size_t memory_needed; /* Size of a context created from this module */
+};
+typedef struct xm_probe_s xm_probe_t;
+
 /**
  * Defines normally passed in as compiler flags, but included here instead.
  **/
@@ -31,15 +50,46 @@ typedef struct xm_context_s xm_context_t;
 #define XM_HAS_OWN_STDOUT
 // Defensively check XM data for errors/inconsistencies
 #define XM_DEFENSIVE
-// Use linear interpolation (CPU hungry)
+// Use linear interpolation (CPU hungry). Can be switched off at run time,
+// see xm_set_quality()
 #define XM_LINEAR_INTERPOLATION
-// Enable ramping (smooth volume/panning transitions, CPU hungry)
+// Enable ramping (smooth volume/panning transitions, CPU hungry). Can be
+// switched off at run time, see xm_set_quality()
 #define XM_RAMPING
+// Keep patterns in packed XM form and unpack only the row being played.
+// Pattern data shrinks to the size it has in the .xm file (2-5x smaller
+// depending on how sparse the patterns are), at the cost of unpacking
+// num_channels slots once per row.
+//#define XM_PACKED_PATTERNS
+// Allow contexts that decode waveforms on demand into a fixed size
+// sample cache, see xm_create_context_cached()
+//#define XM_SAMPLE_CACHE
+// Store waveforms in libxmized images as 4 bit IMA ADPCM, which is about
+// 4x smaller than 16 bit and 2x smaller than 8 bit samples. The mixer
+// decodes a 64 sample block at a time into each channel. Cannot be used
+// with XM_LIBXMIZE_DELTA_SAMPLES.
+//#define XM_ADPCM_SAMPLES
 // Store module, instrument and sample names in context
 //#define XM_STRINGS
-// Use delta-encoded samples in libxmize format. Important to leave this
-// undefined for use with xm_player for teensy.
+// Use delta-encoded samples in libxmize format, which compress better.
+// Shared contexts (and so xm_player) decode them as they play, a 64
+// sample block at a time into each channel.
 //#define XM_LIBXMIZE_DELTA_SAMPLES
+// Precompute the period and frequency of every note of each sample, and
+// the value of enabled envelopes at each frame, when the module is
+// loaded. Libxmized images carry the tables, so the player reads them
+// from flash instead of computing them when notes trigger.
+//#define XM_BAKED_TABLES
+// Give every context this many extra channels, mixed after the module's
+// own, to play sound effects over the song with xm_trigger_voice().
+// Libxmized images hold the voices too, and only load with the same number.
+//#define XM_SFX_VOICES 4
+
+// Memory mapped module loading is only available on POSIX hosts (not
+// on the Teensy), see xm_map_module()
+#if !defined(ARDUINO) && (defined(__unix__) || defined(__APPLE__))
+	#define XM_HAS_MMAP
+#endif
 
 /** Create a XM context.
  *
@@ -67,17 +117,59 @@ int xm_create_context(xm_context_t**, const char* moddata, uint32_t rate);
  */
 int xm_create_context_safe(xm_context_t**, const char* moddata, size_t moddata_length, uint32_t rate);
 
+/** Create a XM context that keeps only sample headers in RAM.
+ *
+ * Waveforms are decoded from the module data the first time they are
+ * triggered, into a sample cache of cache_size bytes. When the cache is
+ * full, the least recently triggered waveforms that are not playing
+ * are evicted. Modules with more sample data than RAM can be played
+ * this way, as long as the waveforms playing at any one time fit in
+ * the cache. A note whose waveform does not fit is not played.
+ *
+ * Requires XM_SAMPLE_CACHE.
+ *
+ * @param moddata the contents of the module, must be readable as long
+ * as the context is active (typically stored in flash)
+ * @param moddata_length the length of the contents of the module, in bytes
+ * @param rate play rate in Hz, recommended value of 48000
+ * @param cache_size size of the sample cache, in bytes
+ *
+ * @returns 0 on success
+ * @returns 1 if module data is not sane
+ * @returns 2 if memory allocation failed
+ */
+int xm_create_context_cached(xm_context_t**, const char* moddata, size_t moddata_length, uint32_t rate, size_t cache_size);
+
+/** Get sample cache counters of a context created by
+ * xm_create_context_cached(). All counters are 0 for other contexts.
+ *
+ * @param hits if not NULL, will receive the number of triggers that
+ * found their waveform in the cache
+ * @param misses if not NULL, will receive the number of triggers
+ * that had to decode their waveform
+ * @param evictions if not NULL, will receive the number of waveforms
+ * evicted to make room
+ * @param used if not NULL, will receive the number of bytes of the
+ * cache in use
+ */
+void xm_get_sample_cache_stats(xm_context_t*, uint32_t* hits, uint32_t* misses, uint32_t* evictions, size_t* used);
+
 /** Create a XM context.
  *
  * This function will produce smaller code size compared to
  * xm_create_context(), but requires converting the .xm file to a
  * non-portable format beforehand.
  *
- * This function doesn't do any kind of error checking.
+ * Only the image header is checked: images made for another platform,
+ * with other settings in xm.h or by an older version are rejected.
+ *
+ * @returns 0 on success
+ * @returns 1 if the image cannot be loaded by this build
+ * @returns 2 if memory allocation failed
  *
  * @see xm_create_context()
  */
-void xm_create_context_from_libxmize(xm_context_t**, const char* libxmizeddata, uint32_t rate);
+int xm_create_context_from_libxmize(xm_context_t**, const char* libxmizeddata, uint32_t rate);
 
 /** Create an XM context with some data remaining in libxmized.
  *
@@ -85,15 +177,125 @@ void xm_create_context_from_libxmize(xm_context_t**, const char* libxmizeddata,
  * xm_create_context(), but requires converting the .xm file to a
  * non-portable format beforehand.
  *
- * This function doesn't do any kind of error checking. Ensure that the
- * libxmized data was created WITHOUT delta encoding.
+ * Only the image header is checked, like
+ * xm_create_context_from_libxmize(). With XM_LIBXMIZE_DELTA_SAMPLES,
+ * waveforms stay delta encoded in libxmized and are decoded by the
+ * mixer as they play.
  *
  * @param libxmized: the data generated by libxmize, must be
  * readadable as long as the context is active.
  *
+ * @returns 0 on success
+ * @returns 1 if the image cannot be loaded by this build
+ * @returns 2 if memory allocation failed
+ *
  * @see xm_create_context()
  */
-void xm_create_shared_context_from_libxmize(xm_context_t** ctxp, const char* libxmized, uint32_t rate);
+int xm_create_shared_context_from_libxmize(xm_context_t** ctxp, const char* libxmized, uint32_t rate);
+
+/** Create a context for one module of a bank made by xm_libxmize_bank().
+ *
+ * Works like xm_create_shared_context_from_libxmize(): pattern and
+ * sample data stay in the bank, which is shared by every module in it.
+ * Switching songs is a matter of freeing one context and creating
+ * another, without loading anything.
+ *
+ * @param bank the bank, must be readable as long as the context is active
+ * @param index of the module in the bank, from 0
+ *
+ * @returns 0 on success
+ * @returns 1 if the bank cannot be loaded by this build, or has no
+ * module index
+ * @returns 2 if memory allocation failed
+ */
+int xm_create_shared_context_from_bank(xm_context_t** ctxp, const char* bank, uint16_t index, uint32_t rate);
+
+/** Number of modules in a bank, or 0 if it cannot be loaded by this build. */
+uint16_t xm_get_bank_size(const char* bank);
+
+/** Read metadata of a module without creating a context.
+ *
+ * Only the module, pattern and instrument headers are read. Nothing is
+ * allocated and sample data is skipped over, so this is cheap enough
+ * to index large module libraries.
+ *
+ * @param moddata the contents of the module
+ * @param moddata_length the length of the contents of the module, in bytes
+ * @param info will receive the metadata
+ *
+ * @returns 0 on success
+ * @returns 1 if module data is not sane
+ */
+int xm_probe(const char* moddata, size_t moddata_length, xm_probe_t* info);
+
+/** Read the name of an instrument without creating a context.
+ *
+ * @param name buffer of at least 23 chars, will receive the
+ * NUL-terminated name
+ *
+ * @note Instrument numbers go from 1 to xm_probe(...)->num_instruments.
+ * Each call reads the headers from the start, use
+ * xm_probe_instrument_names() to list them all.
+ *
+ * @returns 0 on success
+ * @returns 1 if module data is not sane or the instrument does not exist
+ */
+int xm_probe_instrument_name(const char* moddata, size_t moddata_length, uint16_t instr, char* name);
+
+/** Read the names of all instruments in one pass over the headers.
+ *
+ * @param names will receive the NUL-terminated name of instrument i + 1
+ * in names[i], for the first max_names instruments
+ * @param max_names number of names the array holds, names past the
+ * last instrument are left alone
+ *
+ * @returns 0 on success
+ * @returns 1 if module data is not sane
+ */
+int xm_probe_instrument_names(const char* moddata, size_t moddata_length, char names[][23], uint16_t max_names);
+
+#ifdef XM_HAS_MMAP
+struct xm_mapped_module_s;
+typedef struct xm_mapped_module_s xm_mapped_module_t;
+
+/** Map a .xm or libxmized file into memory.
+ *
+ * The file is mapped read only and shared, so any number of processes
+ * mapping the same file share one copy of it in the page cache.
+ *
+ * @param path the file to map
+ *
+ * @returns 0 on success
+ * @returns 1 if the file could not be opened or mapped
+ * @returns 2 if memory allocation failed
+ */
+int xm_map_module(xm_mapped_module_t** mapp, const char* path);
+
+/** Create a XM context from a mapped file.
+ *
+ * .xm files (recognised by their header) are loaded with
+ * xm_create_context_safe() and the context does not refer to the
+ * mapping. Anything else is taken to be a libxmized image created on a
+ * host with the same settings and word size, and is loaded like
+ * xm_create_shared_context_from_libxmize(): patterns and waveforms are
+ * read directly from the mapping. Every offset in the image is checked
+ * against the length of the file first, and playback starts from the
+ * beginning of the song.
+ *
+ * @note Free every context created from a mapping before unmapping it.
+ *
+ * @returns 0 on success
+ * @returns 1 if module data is not sane
+ * @returns 2 if memory allocation failed
+ */
+int xm_create_context_from_mapped(xm_context_t** ctxp, const xm_mapped_module_t* map, uint32_t rate);
+
+/** Get the contents and length of a mapped file. */
+const char* xm_get_mapped_data(const xm_mapped_module_t* map, size_t* length);
+
+/** Unmap a file mapped by xm_map_module(). */
+void xm_unmap_module(xm_mapped_module_t* map);
+#endif
 
 /** Free a XM context created by xm_create_context(). */
 void xm_free_context(xm_context_t*);
@@ -102,9 +304,164 @@ void xm_free_context(xm_context_t*);
  *
  * Convert xm module to libxmlized version and output as a byte array to serial. This is an
  * 'unwrapped' version of the module that can be stored in readonly memory.
+ *
+ * @see xm_libxmize_write() to write the binary image to RAM or a file instead
  **/
 void xm_libxmize( const char* moddata, uint32_t moddata_size );
 
+/** Receives data written by xm_libxmize_write() and friends.
+ *
+ * @param user the pointer passed along with the sink
+ *
+ * @returns false to abort writing
+ */
+typedef bool (*xm_write_func_t)(void* user, const void* data, size_t length);
+
+/** Layout of a libxmized image. Images are a dump of the context
+ * structures, so they can only be loaded by a build with the same
+ * pointer size, alignment rules and xm.h settings. */
+typedef enum {
+	XM_TARGET_NATIVE, /* The machine running the conversion */
+	XM_TARGET_ARM32, /* Teensy 3.x, for converting on a PC */
+} xm_libxmize_target_t;
+
+/** Filled in by xm_libxmize_write() and xm_libxmize_context().
+ *
+ * Samples with identical waveforms and patterns with identical data
+ * (common when instruments reuse a sample, or a pattern is repeated
+ * under another number) share a single copy in the image.
+ */
+struct xm_libxmize_stats_s {
+	size_t image_size; /* Bytes written */
+	size_t saved_bytes; /* Saved by storing copies once */
+	uint16_t shared_samples; /* Samples pointing at another sample's waveform */
+	uint16_t shared_patterns; /* Patterns pointing at another pattern's data */
+};
+typedef struct xm_libxmize_stats_s xm_libxmize_stats_t;
+
+/** Write the libxmized image of a module through a sink.
+ *
+ * The image is written in binary: a small header followed by the
+ * context. For XM_TARGET_NATIVE the context is the memory_needed
+ * reported by xm_probe(), less any data stored once for several
+ * samples or patterns.
+ *
+ * @param stats if not NULL, will receive the image size and savings
+ *
+ * @returns 0 on success
+ * @returns 1 if module data is not sane
+ * @returns 2 if memory allocation failed
+ * @returns 3 if the sink returned false
+ */
+int xm_libxmize_write( const char* moddata, size_t moddata_size, xm_libxmize_target_t target, xm_write_func_t write, void* user,
+                       xm_libxmize_stats_t* stats );
+
+/** Write the libxmized image of an existing context through a sink.
+ *
+ * The context must have been created by xm_create_context_safe() and
+ * not played yet. It is left unchanged.
+ *
+ * @returns 0 on success
+ * @returns 1 if the context does not come from xm_create_context_safe()
+ * @returns 2 if memory allocation failed
+ * @returns 3 if the sink returned false
+ */
+int xm_libxmize_context( xm_context_t* ctx, xm_libxmize_target_t target, xm_write_func_t write, void* user,
+                         xm_libxmize_stats_t* stats );
+
+/** Write a bank of several modules through a sink.
+ *
+ * Each module keeps its own context, but pattern and sample data goes
+ * in a pool shared by all of them, where identical waveforms (the same
+ * drum kit used by several songs) and patterns are stored once. Load
+ * modules with xm_create_shared_context_from_bank(). The contexts are
+ * left unchanged, and the same rules apply as for xm_libxmize_context().
+ *
+ * @param ctxs the contexts of the modules, in bank order
+ * @param stats if not NULL, will receive the bank size and savings
+ *
+ * @returns 0 on success
+ * @returns 1 if a context does not come from xm_create_context_safe(),
+ * or num_modules is 0
+ * @returns 2 if memory allocation failed
+ * @returns 3 if the sink returned false
+ */
+int xm_libxmize_bank( xm_context_t* const* ctxs, uint16_t num_modules, xm_libxmize_target_t target,
+                      xm_write_func_t write, void* user, xm_libxmize_stats_t* stats );
+
+/** Filled in by xm_strip_context(). Counts are of what was removed. */
+struct xm_strip_stats_s {
+	size_t saved_bytes; /* Context bytes freed, including sample tails */
+	size_t sample_tail_bytes; /* Waveform data past the end of loops */
+	uint16_t patterns;
+	uint16_t instruments;
+	uint16_t samples;
+	uint16_t channels;
+};
+typedef struct xm_strip_stats_s xm_strip_stats_t;
+
+/** Remove data that can never be played from a context, in place.
+ *
+ * Drops patterns missing from the order table, instruments no reachable
+ * pattern uses, samples no note of their instrument maps to, channels
+ * that are empty in every reachable pattern, and the waveform past the
+ * loop end of looped samples (unless the song uses 9xx sample offsets).
+ * What is left is renumbered and moved down, so ctx_size shrinks and
+ * xm_libxmize_context() writes a smaller image. Playback is unchanged,
+ * but instrument and channel numbers (e.g. for xm_mute_channel()) may be
+ * different afterwards. With XM_SFX_VOICES every instrument is kept, with
+ * its number, for xm_trigger_voice().
+ *
+ * The context must have been created by xm_create_context_safe() and
+ * not played yet.
+ *
+ * @param stats if not NULL, will receive what was removed
+ *
+ * @returns 0 on success
+ * @returns 1 if the context cannot be stripped (sample cache, or an
+ * order table pointing at missing patterns)
+ * @returns 2 if memory allocation failed, leaving the context unchanged
+ */
+int xm_strip_context( xm_context_t* ctx, xm_strip_stats_t* stats );
+
+/** A RAM buffer to write to with xm_write_to_buffer(). */
+struct xm_buffer_sink_s {
+	char* data;
+	size_t size; /* Capacity of data, in bytes */
+	size_t used; /* Bytes written so far, start at 0 */
+};
+typedef struct xm_buffer_sink_s xm_buffer_sink_t;
+
+/** Sink that appends to a xm_buffer_sink_t. Fails if the buffer is full. */
+bool xm_write_to_buffer( void* buffer, const void* data, size_t length );
+
+#ifndef ARDUINO
+/** Sink that writes to a FILE* opened in binary mode. */
+bool xm_write_to_file( void* file, const void* data, size_t length );
+#endif
+
+/** Formats binary data as a C header (a const char array), passing it
+ * on to another sink one line at a time. */
+#define XM_HEADER_LINE_LENGTH 260
+struct xm_header_writer_s {
+	xm_write_func_t write;
+	void* user;
+	size_t count; /* Bytes formatted so far */
+	uint16_t length; /* Characters in line */
+	char line[XM_HEADER_LINE_LENGTH];
+};
+typedef struct xm_header_writer_s xm_header_writer_t;
+
+/** Start a header, declaring an array called name. */
+bool xm_header_begin( xm_header_writer_t* hw, const char* name, xm_write_func_t write, void* user );
+
+/** Sink that formats data into the header. Pass the xm_header_writer_t
+ * as user, e.g. xm_libxmize_write(moddata, size, target, xm_header_write, &hw, NULL). */
+bool xm_header_write( void* hw, const void* data, size_t length );
+
+/** Close the array and flush the header. */
+bool xm_header_end( xm_header_writer_t* hw );
+
 	
 
 /** Play the module and put the sound samples in an output buffer.
@@ -114,6 +471,44 @@ void xm_libxmize( const char* moddata, uint32_t moddata_size );
  */
 void xm_generate_samples(xm_context_t*, float* output, size_t numsamples);
 
+/** Play the module and add its sound samples, multiplied by gain, to
+ * the output buffer, to mix several modules into one buffer without
+ * another buffer for each.
+ *
+ * @param output buffer of 2*numsamples elements
+ * @param numsamples number of samples to generate
+ * @param gain multiplier of the module's samples
+ */
+void xm_mix_samples(xm_context_t*, float* output, size_t numsamples, float gain);
+
+#ifdef XM_SFX_VOICES
+/** Play a note of one of the module's instruments on a sound effect
+ * voice, over the song. Voices are mixed like the module's channels,
+ * envelopes and fadeout included, but read no pattern, so they cost the
+ * same per sample and leave the song alone. Takes effect from the next
+ * generated sample. Instruments the song never plays can be used too,
+ * xm_strip_context() keeps them when XM_SFX_VOICES is defined.
+ *
+ * @param instrument instrument number, from 1
+ * @param note note number, from 1 (C-0) to 96 (B-7), 49 is C-4
+ * @param volume multiplier of the sample's volume, 0 to 1
+ * @param panning 0 (left) to 1 (right), or negative for the sample's
+ * @param priority a free voice is used first, otherwise the voice with
+ * the lowest priority that started first, if that is not above this
+ *
+ * @returns the voice, from 0, or -1 if all voices play more important
+ * sounds or the instrument has no sample for the note
+ */
+int8_t xm_trigger_voice(xm_context_t*, uint16_t instrument, uint8_t note, float volume, float panning, uint8_t priority);
+
+/** Release the key of a voice, so its instrument fades out (or stops if
+ * it has no volume envelope).
+ *
+ * @param voice as returned by xm_trigger_voice()
+ */
+void xm_release_voice(xm_context_t*, int8_t voice);
+#endif
+
 
 
 /** Set the maximum number of times a module can loop. After the
@@ -139,6 +534,41 @@ uint8_t xm_get_loop_count(xm_context_t*);
  */
 void xm_seek(xm_context_t*, uint8_t pot, uint8_t row, uint16_t tick);
 
+/** Go back to the start of the song, as it was when the context was
+ * created. Playback state is reset from the module: position, tempo,
+ * BPM, global volume, loop count, and every channel and voice. Pattern
+ * and sample data are left alone, so this costs far less than loading
+ * the module again. Settings made through this API (amplification,
+ * maximum loop count, muted channels and instruments, quality) are kept.
+ */
+void xm_reset(xm_context_t*);
+
+/* Values of rows for xm_schedule_jump(). Modules do not say how many
+ * rows make a beat, 4 is what most trackers highlight. */
+#define XM_JUMP_PATTERN 0
+#define XM_JUMP_ROW 1
+#define XM_JUMP_BEAT 4
+
+/** Jump to another position once the song reaches a boundary, so that
+ * the music changes in time. The jump is made by the player like a Bxx
+ * effect, at the start of a row, and replaces any jump scheduled
+ * before. Safe to call while samples are generated by the same thread
+ * only.
+ *
+ * @param pot position in the POT (pattern order table) to jump to
+ * @param row row of that pattern to start at
+ * @param rows jump before the next row that is a multiple of this many
+ * rows in its pattern (XM_JUMP_ROW, XM_JUMP_BEAT), or that starts a
+ * pattern (XM_JUMP_PATTERN). A pattern break or position jump in the
+ * song counts as a boundary too.
+ * @param fade if true, notes still playing are cut when the jump is made,
+ * so only the new position is heard. With XM_RAMPING they ramp down
+ * instead of clicking.
+ *
+ * @returns false if pot or row is out of range
+ */
+bool xm_schedule_jump(xm_context_t*, uint8_t pot, uint8_t row, uint8_t rows, bool fade);
+
 
 
 /** Mute or unmute a channel.
@@ -160,6 +590,40 @@ bool xm_mute_instrument(xm_context_t*, uint16_t, bool);
 
 
 
+/* Flags of xm_set_quality() */
+#define XM_QUALITY_INTERPOLATION 1 /* Needs XM_LINEAR_INTERPOLATION */
+#define XM_QUALITY_RAMPING 2 /* Needs XM_RAMPING */
+#define XM_QUALITY_ALL (XM_QUALITY_INTERPOLATION | XM_QUALITY_RAMPING)
+
+/** Choose which of the features compiled in are used to generate
+ * samples, trading sound for CPU time. Contexts are created with all of
+ * them. Turning ramping off can make volume changes and new notes
+ * click, turning interpolation off makes samples played below their
+ * rate sound grainy. Safe to call between calls generating samples.
+ *
+ * @param quality XM_QUALITY_* flags, flags of features not compiled in
+ * are ignored
+ */
+void xm_set_quality(xm_context_t*, uint8_t quality);
+
+/** Get the XM_QUALITY_* flags in use. */
+uint8_t xm_get_quality(xm_context_t*);
+
+/** Mix at most this many channels (sound effect voices included),
+ * dropping the quietest ones first. The choice is made again every
+ * tick. Dropped channels keep their place in the sample, and are heard
+ * again where they would have been once they are loud enough or the
+ * limit is raised.
+ *
+ * @param channels most channels to mix, 0 to mix all of them
+ */
+void xm_set_max_mixed_channels(xm_context_t*, uint8_t channels);
+
+/** Get the limit set by xm_set_max_mixed_channels(), 0 if there is none. */
+uint8_t xm_get_max_mixed_channels(xm_context_t*);
+
+
+
 /** Get the module name as a NUL-terminated string. */
 const char* xm_get_module_name(xm_context_t*);
 
@@ -205,6 +669,16 @@ uint16_t xm_get_number_of_samples(xm_context_t*, uint16_t);
  *
  * @note Sample numbers go from 0 to
  * xm_get_nubmer_of_samples(...,instr)-1.
+ *
+ * @note Contexts created by xm_create_context_cached() return NULL
+ * for waveforms that are not in the sample cache.
+ *
+ * @note With XM_ADPCM_SAMPLES, waveforms of contexts loaded from
+ * libxmized images are ADPCM blocks in the image and must not be
+ * written to. bits is the resolution they were encoded from.
+ *
+ * @note With XM_LIBXMIZE_DELTA_SAMPLES, waveforms of shared contexts
+ * are delta encoded (each value is the difference from the previous one).
  */
 void* xm_get_sample_waveform(xm_context_t*, uint16_t instr, uint16_t sample, size_t* length, uint8_t* bits);
 
@@ -17,6 +17,9 @@
 
 void xm_stdout( const char *str );
 void xm_delay( uint32_t ms );
+/* Microseconds from any fixed point, wrapping at 2^32. Only the player
+ * uses it, to time updates. */
+uint32_t xm_micros( void );
 #ifndef XM_HAS_OWN_STDOUT
 	#include <stdio.h>
 	#include <stdarg.h>
@@ -51,6 +54,27 @@ extern int __fail[-1];
 	#define XM_SAMPLE_RAMPING_POINTS 0x20
 #endif
 
+#ifdef XM_ADPCM_SAMPLES
+	#ifdef XM_LIBXMIZE_DELTA_SAMPLES
+		#error "XM_ADPCM_SAMPLES and XM_LIBXMIZE_DELTA_SAMPLES cannot be used together"
+	#endif
+	/* Blocks are a 4 byte header and one nibble per sample after the first */
+	#define XM_ADPCM_BLOCK_SAMPLES 64
+	#define XM_ADPCM_BLOCK_BYTES (4 + XM_ADPCM_BLOCK_SAMPLES / 2)
+#endif
+
+#ifdef XM_LIBXMIZE_DELTA_SAMPLES
+	/* Delta encoded waveforms in images have a keyframe (the decoded
+	 * value) at the start of every block of this many samples */
+	#define XM_DELTA_BLOCK_SAMPLES 64
+#endif
+
+#ifdef XM_BAKED_TABLES
+	/* Envelopes whose last point is further out are computed as they
+	 * play, to bound the size of their table */
+	#define XM_MAX_BAKED_ENVELOPE_FRAMES 512
+#endif
+
 /* ----- Data types ----- */
 
 enum xm_waveform_type_e {
@@ -90,6 +114,12 @@ struct xm_envelope_s {
 	bool enabled;
 	bool sustain_enabled;
 	bool loop_enabled;
+
+	#ifdef XM_BAKED_TABLES
+		/* Value at each frame up to the last point, NULL if computed
+		 * as the envelope plays */
+		float* baked;
+	#endif
 };
 typedef struct xm_envelope_s xm_envelope_t;
 
@@ -98,6 +128,12 @@ struct xm_sample_s {
 	char name[SAMPLE_NAME_LENGTH + 1];
 #endif
 	uint8_t bits; /* Either 8 or 16 */
+	#ifdef XM_ADPCM_SAMPLES
+		bool adpcm; /* Waveform is stored as ADPCM blocks, see adpcm.c */
+	#endif
+	#ifdef XM_LIBXMIZE_DELTA_SAMPLES
+		bool delta; /* Waveform is delta encoded and followed by keyframes */
+	#endif
 
 	uint32_t length;
 	uint32_t loop_start;
@@ -114,6 +150,20 @@ struct xm_sample_s {
 		int8_t* data8;
 		int16_t* data16;
 	};
+
+	#ifdef XM_SAMPLE_CACHE
+		uint32_t data_offset; /* Offset of the sample data in the module */
+	#endif
+
+	#ifdef XM_BAKED_TABLES
+		/* Frequency (without vibrato or arpeggio) of pattern notes
+		 * baked_first_note to baked_first_note + baked_num_notes - 1,
+		 * those the instrument plays this sample for. NULL if there
+		 * are none. */
+		float* baked_frequencies;
+		uint8_t baked_first_note;
+		uint8_t baked_num_notes;
+	#endif
 };
 typedef struct xm_sample_s xm_sample_t;
 
@@ -148,7 +198,14 @@ typedef struct xm_pattern_slot_s xm_pattern_slot_t;
 
 struct xm_pattern_s {
 	uint16_t num_rows;
-	xm_pattern_slot_t* slots; /* Array of size num_rows * num_channels */
+	#ifdef XM_PACKED_PATTERNS
+		uint16_t packed_size; /* Size of the packed data, in bytes */
+	#endif
+
+	union {
+		xm_pattern_slot_t* slots; /* Array of size num_rows * num_channels */
+		uint8_t* packed; /* Packed XM pattern data, see XM_PACKED_PATTERNS */
+	};
 };
 typedef struct xm_pattern_s xm_pattern_t;
 
@@ -162,6 +219,8 @@ struct xm_module_s {
 	uint16_t num_channels;
 	uint16_t num_patterns;
 	uint16_t num_instruments;
+	uint16_t tempo; /* At the start of the song, ctx->tempo is the current one */
+	uint16_t bpm; /* Same for ctx->bpm */
 	xm_frequency_type_t frequency_type;
 	uint8_t pattern_table[PATTERN_ORDER_TABLE_LENGTH];
 
@@ -232,6 +291,7 @@ struct xm_channel_context_s {
 
 	uint64_t latest_trigger;
 	bool muted;
+	bool dropped; /* Not mixed this tick, see xm_set_max_mixed_channels() */
 
 	#ifdef XM_RAMPING
 		/* These values are updated at the end of each tick, to save
@@ -243,11 +303,53 @@ struct xm_channel_context_s {
 		float end_of_previous_sample[XM_SAMPLE_RAMPING_POINTS];
 	#endif
 
+	#ifdef XM_ADPCM_SAMPLES
+		/* Decoded copy of the last ADPCM block read by this channel */
+		xm_sample_t* adpcm_sample;
+		uint32_t adpcm_first; /* Index of adpcm_buffer[0] in the waveform */
+		uint32_t adpcm_count; /* Samples of adpcm_buffer that belong to it */
+		int16_t adpcm_buffer[XM_ADPCM_BLOCK_SAMPLES];
+	#endif
+
+	#ifdef XM_LIBXMIZE_DELTA_SAMPLES
+		/* Decoded copy of the last delta block read by this channel */
+		xm_sample_t* delta_sample;
+		uint32_t delta_first; /* Index of delta_buffer[0] in the waveform */
+		uint32_t delta_count; /* Samples of delta_buffer that belong to it */
+		int16_t delta_buffer[XM_DELTA_BLOCK_SAMPLES];
+	#endif
+
 	float actual_panning;
 	float actual_volume;
 };
 typedef struct xm_channel_context_s xm_channel_context_t;
 
+#ifdef XM_SAMPLE_CACHE
+	struct xm_sample_cache_entry_s {
+		xm_sample_t* sample;
+		uint32_t offset; /* Offset of the waveform in the arena */
+		uint32_t size;
+		uint32_t last_use;
+	};
+	typedef struct xm_sample_cache_entry_s xm_sample_cache_entry_t;
+
+	struct xm_sample_cache_s {
+		const char* moddata; /* Waveforms are decoded from here */
+		size_t moddata_length;
+
+		char* arena;
+		size_t arena_size;
+		xm_sample_cache_entry_t* entries; /* Sorted by offset */
+		uint16_t num_entries;
+		uint32_t clock;
+
+		uint32_t hits;
+		uint32_t misses;
+		uint32_t evictions;
+	};
+	typedef struct xm_sample_cache_s xm_sample_cache_t;
+#endif
+
 struct xm_context_s {
 	size_t ctx_size; /* Must be first, see xm_create_context_from_libxmize() */
 	xm_module_t module;
@@ -266,6 +368,12 @@ struct xm_context_s {
 		float panning_ramp; /* Same for panning. */
 	#endif
 
+	uint8_t quality; /* XM_QUALITY_* flags in use */
+	uint8_t max_mixed_channels; /* 0 for no limit */
+	/* Frames generated since the last tick. Dropped channels move on by
+	 * this much when the next tick starts. */
+	uint16_t tick_frames;
+
 	uint8_t current_table_index;
 	uint8_t current_row;
 	uint16_t current_tick; /* Can go below 255, with high tempo and a pattern delay */
@@ -277,20 +385,190 @@ struct xm_context_s {
 	uint8_t jump_dest;
 	uint8_t jump_row;
 
+	/* Jump requested by xm_schedule_jump(), turned into a position
+	 * jump by xm_row() once the row to play is a multiple of
+	 * scheduled_rows, or starts a pattern if scheduled_rows is 0 */
+	bool scheduled_jump;
+	bool scheduled_fade;
+	uint8_t scheduled_rows;
+	uint8_t scheduled_dest;
+	uint8_t scheduled_row;
+
 	/* Extra ticks to be played before going to the next row -
 	 * Used for EEy effect */
 	uint16_t extra_ticks;
 
-	uint8_t* row_loop_count; /* Array of size MAX_NUM_ROWS * module_length */
+	#ifdef XM_PACKED_PATTERNS
+		/* Patterns are kept packed, the row being played is unpacked
+		 * here. The read cursor remembers where the next row starts in
+		 * the packed data so that sequential playback never rescans
+		 * a pattern. */
+		xm_pattern_slot_t* row_cache; /* Array of size num_channels */
+		uint16_t row_cache_pattern; /* Pattern the read cursor is in */
+		uint16_t row_cache_row; /* Row the read cursor points to */
+		uint16_t row_cache_offset; /* Offset of that row in the packed data */
+	#endif
+
+	/* Rows visited since the module last looped, one bit per row of
+	 * each POT entry. Seeing a row twice means the module looped. */
+	uint8_t* row_visited; /* Bitset of ROW_VISITED_BYTES(module_length, row_visited_stride) bytes */
 	uint8_t loop_count;
 	uint8_t max_loop_count;
+	uint16_t row_visited_stride; /* Bits per POT entry, number of rows of the longest pattern */
 
 	xm_channel_context_t* channels;
+
+	#ifdef XM_SFX_VOICES
+		/* Sound effect voices follow the module's channels in the
+		 * channels array, and play voice_row instead of a pattern */
+		uint8_t num_voices;
+		uint8_t voice_priority[XM_SFX_VOICES];
+		xm_pattern_slot_t voice_row;
+	#endif
+
+	#ifdef XM_SAMPLE_CACHE
+		xm_sample_cache_t* sample_cache; /* NULL unless created by xm_create_context_cached() */
+	#endif
+};
+
+/* ----- libxmize image header ----- */
+
+/* Images start with this header. It only uses fixed size fields at
+ * natural alignments, so it reads the same on every platform. Sections
+ * are offsets in the image, the context section holds the context
+ * mempool with pointers stored as offsets from its start.
+ *
+ * Banks hold several modules. Their bank section is a table of context
+ * sections, one per module, and their pattern and sample data is in the
+ * pool section after the last context, where pointers reach it as
+ * offsets from the start of their context. */
+
+#define XM_IMAGE_MAGIC "LXMZ"
+/* Bump when fields move without changing the size of a struct, which the
+ * layout hash cannot see. 2: jump scheduling fields in the context.
+ * 3: initial tempo and BPM in the module. 4: quality settings in the
+ * context, dropped flag in channels. */
+#define XM_IMAGE_VERSION 4
+#define XM_IMAGE_MAX_SECTIONS 8
+
+enum xm_image_section_type_e {
+	XM_SECTION_NONE = 0,
+	XM_SECTION_CONTEXT = 1,
+	XM_SECTION_BANK = 2,
+	XM_SECTION_POOL = 3,
 };
 
+/* Settings from xm.h that change the contents of an image */
+#define XM_IMAGE_FEATURE_RAMPING (1 << 0)
+#define XM_IMAGE_FEATURE_STRINGS (1 << 1)
+#define XM_IMAGE_FEATURE_DELTA_SAMPLES (1 << 2)
+#define XM_IMAGE_FEATURE_PACKED_PATTERNS (1 << 3)
+#define XM_IMAGE_FEATURE_SAMPLE_CACHE (1 << 4)
+#define XM_IMAGE_FEATURE_ADPCM_SAMPLES (1 << 5)
+#define XM_IMAGE_FEATURE_BAKED_TABLES (1 << 6)
+#define XM_IMAGE_FEATURE_SFX_VOICES (1 << 7)
+/* The number of voices is in these bits of the features, images with
+ * another number are rejected. Contexts are the same size for any
+ * number of voices, so the layout hash cannot tell. */
+#define XM_IMAGE_SFX_VOICES_SHIFT 8
+
+#ifdef XM_RAMPING
+	#define XM_IMAGE_HAS_RAMPING XM_IMAGE_FEATURE_RAMPING
+#else
+	#define XM_IMAGE_HAS_RAMPING 0
+#endif
+#if XM_STRINGS
+	#define XM_IMAGE_HAS_STRINGS XM_IMAGE_FEATURE_STRINGS
+#else
+	#define XM_IMAGE_HAS_STRINGS 0
+#endif
+#ifdef XM_LIBXMIZE_DELTA_SAMPLES
+	#define XM_IMAGE_HAS_DELTA_SAMPLES XM_IMAGE_FEATURE_DELTA_SAMPLES
+#else
+	#define XM_IMAGE_HAS_DELTA_SAMPLES 0
+#endif
+#ifdef XM_PACKED_PATTERNS
+	#define XM_IMAGE_HAS_PACKED_PATTERNS XM_IMAGE_FEATURE_PACKED_PATTERNS
+#else
+	#define XM_IMAGE_HAS_PACKED_PATTERNS 0
+#endif
+#ifdef XM_SAMPLE_CACHE
+	#define XM_IMAGE_HAS_SAMPLE_CACHE XM_IMAGE_FEATURE_SAMPLE_CACHE
+#else
+	#define XM_IMAGE_HAS_SAMPLE_CACHE 0
+#endif
+#ifdef XM_ADPCM_SAMPLES
+	#define XM_IMAGE_HAS_ADPCM_SAMPLES XM_IMAGE_FEATURE_ADPCM_SAMPLES
+#else
+	#define XM_IMAGE_HAS_ADPCM_SAMPLES 0
+#endif
+#ifdef XM_BAKED_TABLES
+	#define XM_IMAGE_HAS_BAKED_TABLES XM_IMAGE_FEATURE_BAKED_TABLES
+#else
+	#define XM_IMAGE_HAS_BAKED_TABLES 0
+#endif
+#ifdef XM_SFX_VOICES
+	#define XM_IMAGE_HAS_SFX_VOICES (XM_IMAGE_FEATURE_SFX_VOICES \
+	                                 | ((uint32_t)(XM_SFX_VOICES) << XM_IMAGE_SFX_VOICES_SHIFT))
+#else
+	#define XM_IMAGE_HAS_SFX_VOICES 0
+#endif
+#define XM_IMAGE_FEATURES (XM_IMAGE_HAS_RAMPING | XM_IMAGE_HAS_STRINGS | XM_IMAGE_HAS_DELTA_SAMPLES \
+                           | XM_IMAGE_HAS_PACKED_PATTERNS | XM_IMAGE_HAS_SAMPLE_CACHE \
+                           | XM_IMAGE_HAS_ADPCM_SAMPLES | XM_IMAGE_HAS_BAKED_TABLES \
+                           | XM_IMAGE_HAS_SFX_VOICES)
+
+struct xm_image_section_s {
+	uint32_t type; /* xm_image_section_type_e, XM_SECTION_NONE if unused */
+	uint32_t offset; /* From the start of the image */
+	uint32_t length;
+};
+typedef struct xm_image_section_s xm_image_section_t;
+
+struct xm_image_header_s {
+	char magic[4]; /* XM_IMAGE_MAGIC */
+	uint16_t version; /* XM_IMAGE_VERSION */
+	uint16_t header_size;
+	uint32_t layout_hash; /* See xm_image_layout_hash() */
+	uint32_t features; /* XM_IMAGE_FEATURE_* flags */
+	uint32_t image_size; /* Header and all sections, in bytes */
+	uint32_t reserved;
+	xm_image_section_t sections[XM_IMAGE_MAX_SECTIONS];
+};
+typedef struct xm_image_header_s xm_image_header_t;
+
+/* Structs whose sizes go in the layout hash, in this order */
+#define XM_IMAGE_NUM_STRUCTS 7
+
 /* ----- Internal API ----- */
 
 #define PAD_TO_WORD(size) (((size) + 3) & ~0x03)
+#define ROW_VISITED_BYTES(length, stride) (((size_t)(length) * (stride) + 7) >> 3)
+
+/* Channels that are ticked and mixed, the module's and the voices */
+#ifdef XM_SFX_VOICES
+	#define XM_MIXED_CHANNELS(ctx) ((ctx)->module.num_channels + (ctx)->num_voices)
+#else
+	#define XM_MIXED_CHANNELS(ctx) ((ctx)->module.num_channels)
+#endif
+
+/* XM_QUALITY_* flags that can be used, and whether they are. Features
+ * not compiled in test as false, so their code is left out. */
+#ifdef XM_LINEAR_INTERPOLATION
+	#define XM_HAS_INTERPOLATION XM_QUALITY_INTERPOLATION
+	#define XM_INTERPOLATION_ON(ctx) ((ctx)->quality & XM_QUALITY_INTERPOLATION)
+#else
+	#define XM_HAS_INTERPOLATION 0
+	#define XM_INTERPOLATION_ON(ctx) false
+#endif
+#ifdef XM_RAMPING
+	#define XM_HAS_RAMPING XM_QUALITY_RAMPING
+	#define XM_RAMPING_ON(ctx) ((ctx)->quality & XM_QUALITY_RAMPING)
+#else
+	#define XM_HAS_RAMPING 0
+	#define XM_RAMPING_ON(ctx) false
+#endif
+#define XM_QUALITY_COMPILED (XM_HAS_INTERPOLATION | XM_HAS_RAMPING)
 
 /** Check the module data for errors/inconsistencies.
  *
@@ -310,8 +588,9 @@ int xm_check_sanity_postload(xm_context_t*);
  * Things that are dynamically allocated:
  * - sample data
  * - sample structures in instruments
+ * - baked tables (XM_BAKED_TABLES)
  * - pattern data
- * - row loop count arrays
+ * - visited rows bitset
  * - pattern structures in module
  * - instrument structures in module
  * - channel contexts
@@ -319,12 +598,210 @@ int xm_check_sanity_postload(xm_context_t*);
 
  * @returns 0 if everything looks OK.
  */
-size_t xm_get_memory_needed_for_context(const char*, size_t);
+size_t xm_get_memory_needed_for_context(const char*, size_t, uint8_t load);
+
+/** Get the number of rows of the longest pattern, used as the stride
+ * of the visited rows bitset.
+ */
+uint16_t xm_get_max_num_rows(const xm_pattern_t*, uint16_t num_patterns);
+
+#ifdef XM_SFX_VOICES
+/** Set up the sound effect voices, which must follow the module's
+ * channels in ctx->channels, and set num_voices.
+ */
+void xm_init_voices(xm_context_t*);
+#endif
+
+/** Unpack one row of packed XM pattern data.
+ *
+ * Reads past packed_size are treated as zeroes, so a truncated or
+ * empty pattern unpacks as empty slots.
+ *
+ * @param offset offset of the row in the packed data
+ * @param row array of num_channels slots to unpack into
+ *
+ * @returns offset of the next row in the packed data
+ */
+uint16_t xm_unpack_row(const uint8_t* packed, uint16_t packed_size, uint16_t offset,
+                       xm_pattern_slot_t* row, uint16_t num_channels);
+
+/* What xm_load_module() loads besides the headers */
+#define XM_LOAD_PATTERN_DATA (1 << 0)
+#define XM_LOAD_SAMPLE_DATA (1 << 1)
 
 /** Populate the context from module data.
+ *
+ * @param load XM_LOAD_* flags. Without XM_LOAD_PATTERN_DATA or
+ * XM_LOAD_SAMPLE_DATA, no memory is used for pattern data or waveforms
+ * and their pointers are left NULL
  *
  * @returns pointer to the memory pool
  */
-char* xm_load_module(xm_context_t*, const char*, size_t, char*);
+char* xm_load_module(xm_context_t*, const char*, size_t, char*, uint8_t load);
+
+/** Find the pattern and sample data of a module.
+ *
+ * @param patterns will receive the offset of each pattern header, for
+ * xm_load_pattern_data()
+ * @param samples will receive the offset of the data of each sample, in
+ * instrument order, for xm_load_sample_data()
+ */
+void xm_locate_module_data(const char*, size_t, size_t* patterns, size_t* samples);
+
+/** Load (unpack, unless XM_PACKED_PATTERNS) the data of a pattern from
+ * module data into pat->slots.
+ *
+ * @param offset offset of the pattern header in the module
+ */
+void xm_load_pattern_data(xm_pattern_t* pat, uint16_t num_channels, const char*, size_t, size_t offset);
+
+/** Decode the (delta-encoded) waveform of a sample from module data
+ * into sample->data8.
+ *
+ * @param offset offset of the sample data in the module
+ */
+void xm_load_sample_data(xm_sample_t*, const char*, size_t, size_t offset);
+
+/** Hash the sizes of the structs stored in images (context, module,
+ * pattern, instrument, sample, envelope, channel), so that images
+ * written for another ABI or with other settings are rejected.
+ */
+uint32_t xm_image_layout_hash(const uint32_t sizes[XM_IMAGE_NUM_STRUCTS]);
+
+/** Check the header of a libxmized image, in constant time.
+ *
+ * @param length length of the image, or SIZE_MAX if unknown
+ * @param context will receive the start of the context section
+ * @param context_length if not NULL, will receive its length
+ *
+ * @returns 0 if the image can be loaded by this build
+ */
+int xm_check_image(const char* image, size_t length, const char** context, size_t* context_length);
+
+/** Check the header of a bank image and find one of its modules.
+ *
+ * @param index module to find, pass 0 and num_modules to only count them
+ * @param num_modules if not NULL, will receive the number of modules
+ *
+ * @returns 0 if the image is a bank this build can load and index is
+ * one of its modules
+ */
+int xm_check_bank(const char* image, size_t length, uint16_t index, const char** context, uint16_t* num_modules);
+
+/** Create a context from the headers of a module only. Pattern data and
+ * waveforms are not loaded and their pointers are NULL, so it cannot be
+ * played. Used to write images without holding the whole module in RAM.
+ *
+ * @returns 0 on success
+ * @returns 1 if module data is not sane
+ * @returns 2 if memory allocation failed
+ */
+int xm_create_skeleton_context(xm_context_t** ctxp, const char* moddata, size_t moddata_length, uint32_t rate);
+
+#ifdef XM_SAMPLE_CACHE
+	/** Make sure the waveform of a sample is in the sample cache.
+	 *
+	 * May evict least recently used waveforms that are not playing in
+	 * any channel.
+	 *
+	 * @returns false if the waveform does not fit in the cache
+	 */
+	bool xm_sample_cache_fetch(xm_context_t*, xm_sample_t*);
+
+	/* Whether the waveform of a sample can be read. Cached waveforms
+	 * have no data until they are fetched, or after they are evicted or
+	 * failed to fit. */
+	#define XM_SAMPLE_LOADED(s) ((s)->data8 != NULL)
+#else
+	#define XM_SAMPLE_LOADED(s) true
+#endif
+
+#ifdef XM_BAKED_TABLES
+	/** Number of frames of the baked table of an envelope, 0 if it is
+	 * not baked.
+	 *
+	 * @param last_frame frame of the last point
+	 */
+	uint16_t xm_baked_envelope_frames(bool enabled, uint8_t num_points, uint16_t last_frame);
+
+	/** Range of pattern notes an instrument plays a sample for, from
+	 * its sample_of_notes.
+	 *
+	 * @param first will receive the first note (1-96)
+	 *
+	 * @returns the number of notes from first to the last one
+	 */
+	uint8_t xm_baked_note_range(const uint8_t* sample_of_notes, uint16_t sample, uint8_t* first);
+
+	/** Fill the baked table of an envelope, of
+	 * xm_baked_envelope_frames() values. */
+	void xm_bake_envelope(xm_envelope_t*, float* table);
+
+	/** Fill the baked frequencies of a sample. */
+	void xm_bake_frequencies(xm_context_t*, xm_sample_t*, float* table);
+#endif
+
+#ifdef XM_ADPCM_SAMPLES
+	/** First sample of a sample's waveform that does not go in the same
+	 * run of ADPCM blocks as sample 0: loop_start for looped samples, 0
+	 * otherwise. */
+	uint32_t xm_adpcm_split(const xm_sample_t*);
+
+	/** Find the ADPCM block holding sample k of a waveform.
+	 *
+	 * @param first will receive the index of the first sample in the block
+	 * @param count will receive the number of samples in the block
+	 *
+	 * @returns the index of the block
+	 */
+	uint32_t xm_adpcm_block_of(const xm_sample_t*, uint32_t k, uint32_t* first, uint32_t* count);
+
+	/** Size of a waveform once ADPCM encoded, in bytes. */
+	uint32_t xm_adpcm_size(const xm_sample_t*);
+
+	/** First sample of an ADPCM block, which needs no decoding. */
+	int16_t xm_adpcm_first(const uint8_t* block);
+
+	/** Decode XM_ADPCM_BLOCK_SAMPLES samples from an ADPCM block. */
+	void xm_adpcm_decode_block(const uint8_t* block, int16_t* out);
+
+	/** Encode the PCM waveform of a sample as ADPCM blocks.
+	 *
+	 * @returns false if write failed
+	 */
+	bool xm_adpcm_encode(const xm_sample_t*, xm_write_func_t write, void* user);
+#endif
+
+#ifdef XM_LIBXMIZE_DELTA_SAMPLES
+	/** First sample of a sample's waveform that does not go in the same
+	 * run of delta blocks as sample 0: loop_start for looped samples, 0
+	 * otherwise. */
+	uint32_t xm_delta_split(const xm_sample_t*);
+
+	/** Find the delta block holding sample k of a waveform.
+	 *
+	 * @param first will receive the index of the first sample in the block
+	 * @param count will receive the number of samples in the block
+	 *
+	 * @returns the index of the block
+	 */
+	uint32_t xm_delta_block_of(const xm_sample_t*, uint32_t k, uint32_t* first, uint32_t* count);
+
+	/** Size of a waveform once delta encoded with its keyframes, in bytes. */
+	uint32_t xm_delta_size(const xm_sample_t*);
+
+	/** First sample of a delta block, as a 16 bit value. */
+	int16_t xm_delta_keyframe(const xm_sample_t*, uint32_t block);
+
+	/** Decode the count samples of a delta block as 16 bit values. */
+	void xm_delta_decode_block(const xm_sample_t*, uint32_t block, uint32_t first, uint32_t count, int16_t* out);
+
+	/** Delta encode the PCM waveform of a sample, followed by its
+	 * keyframes.
+	 *
+	 * @returns false if write failed
+	 */
+	bool xm_delta_encode(const xm_sample_t*, xm_write_func_t write, void* user);
+#endif
 
 #endif
@@ -0,0 +1,104 @@
+/* Author: Peter "Projectitis" Vullings <peter@projectitis.com> */
+
+/* This program is free software. It comes without any warranty, to the
+ * extent permitted by applicable law. You can redistribute it and/or
+ * modify it under the terms of the Do What The Fuck You Want To Public
+ * License, Version 2, as published by Sam Hocevar. See
+ * http://sam.zoy.org/wtfpl/COPYING for more details. */
+
+/**
+ * Audio output backends for the player.
+ *
+ * A backend takes stereo frames from the player at its own rate. It is
+ * handed a consume function when the player starts, and calls it from its
+ * interrupt or thread for the frames it needs next. The player never
+ * calls into a backend except to start and stop it, so the same player
+ * drives the Teensy DACs (xm_t3.cpp) and the stand-ins below on a PC.
+ **/
+
+#ifndef __has_xm_output_h_
+#define __has_xm_output_h_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * Supplied by the player to a backend when it starts. Copies up to count
+ * stereo frames (left, right pairs) the player has rendered into frames.
+ *
+ * Backends that play in real time pass due = true: the frames are needed
+ * now, so any the player has not rendered yet are filled as
+ * xm_player_underrun() says, and counted as underruns. Backends that can
+ * wait, such as files, pass false and are given only what is ready.
+ * @return		the number of frames the player had rendered
+ **/
+typedef uint16_t (*xm_output_consume_t)( float* frames, uint16_t count, bool due );
+
+typedef struct xm_output_s {
+	uint32_t rate;		// Frames per second
+
+	/**
+	 * Start calling consume. May be called again after stop.
+	 * @return		false if the output could not be started
+	 **/
+	bool (*start)( struct xm_output_s* output, xm_output_consume_t consume );
+
+	/**
+	 * Stop calling consume. Once this returns, consume is not running and
+	 * will not be called again until the next start.
+	 **/
+	void (*stop)( struct xm_output_s* output );
+
+	void* user;			// For the backend
+} xm_output_t;
+
+/**
+ * The backend the player uses until xm_player_output() picks another.
+ * Defined by the platform: the DACs on a Teensy, a null sink on a PC.
+ **/
+extern xm_output_t* const xm_output_default;
+
+#ifndef ARDUINO
+
+/**
+ * Host backends, for running and measuring the player on a PC. Each runs
+ * its own thread while started. Free them with xm_output_free().
+ **/
+
+/**
+ * Take frames as soon as the player renders them and drop them. Runs the
+ * player as fast as it can go.
+ * @return		false if out of memory
+ **/
+bool xm_output_null( xm_output_t* output, uint32_t rate );
+
+/**
+ * Write frames as soon as the player renders them to a 32 bit float
+ * stereo WAV file. Stopping writes out every frame still in the buffer,
+ * then fills in the sizes in the header.
+ * @return		false if the file could not be created
+ **/
+bool xm_output_wav( xm_output_t* output, uint32_t rate, const char* filename );
+
+/**
+ * Simulate a device: every period_us microseconds take the frames that
+ * became due in that time, whether the player has rendered them or not,
+ * as a DAC interrupt or sound card would. Frames are dropped.
+ * @return		false if out of memory
+ **/
+bool xm_output_paced( xm_output_t* output, uint32_t rate, uint32_t period_us );
+
+/**
+ * Frames a host backend has taken since it was created, including those
+ * filled in for underruns
+ **/
+uint64_t xm_output_frames( const xm_output_t* output );
+
+/**
+ * Stop a host backend if it is running, close its file and free it
+ **/
+void xm_output_free( xm_output_t* output );
+
+#endif
+
+#endif
@@ -0,0 +1,221 @@
+/* Author: Peter "Projectitis" Vullings <peter@projectitis.com> */
+
+/* This program is free software. It comes without any warranty, to the
+ * extent permitted by applicable law. You can redistribute it and/or
+ * modify it under the terms of the Do What The Fuck You Want To Public
+ * License, Version 2, as published by Sam Hocevar. See
+ * http://sam.zoy.org/wtfpl/COPYING for more details. */
+
+/**
+ * Output backends for running the player on a PC, see xm_output.h. The
+ * Arduino IDE builds every file in the library, so this one is empty
+ * there.
+ **/
+
+#ifndef ARDUINO
+
+#include "xm_output.h"
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+/**
+ * Frames taken per call to consume
+ **/
+#define XM_HOST_CHUNK	256
+
+typedef enum {
+	XM_HOST_NULL,
+	XM_HOST_WAV,
+	XM_HOST_PACED
+} xm_host_kind_t;
+
+typedef struct {
+	xm_host_kind_t kind;
+	uint32_t period_us;				// XM_HOST_PACED only
+	FILE* file;						// XM_HOST_WAV only
+	uint32_t data_bytes;			// Written to file so far
+	std::thread thread;
+	std::atomic<bool> running;
+	std::atomic<uint64_t> frames;
+	xm_output_consume_t consume;
+} xm_host_t;
+
+static void write_uint32_le( uint8_t* p, uint32_t v ){
+	p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+static void write_uint16_le( uint8_t* p, uint16_t v ){
+	p[0] = v; p[1] = v >> 8;
+}
+
+/**
+ * WAVE header for 32 bit float stereo, see xm_player_save() in xm_t3.cpp
+ **/
+static bool xm_host_wav_header( FILE* file, uint32_t rate, uint32_t data_bytes ){
+	uint8_t h[44];
+
+	memcpy( h, "RIFF", 4 );
+	write_uint32_le( h + 4, 36 + data_bytes );		// Chunk size
+	memcpy( h + 8, "WAVEfmt ", 8 );
+	write_uint32_le( h + 16, 16 );					// Format chunk size
+	write_uint16_le( h + 20, 3 );					// IEEE float sample data
+	write_uint16_le( h + 22, 2 );					// Two channels
+	write_uint32_le( h + 24, rate );				// Frames/sec (sampling rate)
+	write_uint32_le( h + 28, rate * 2 * sizeof(float) );	// nAvgBytesPerSec
+	write_uint16_le( h + 32, 2 * sizeof(float) );	// nBlockAlign
+	write_uint16_le( h + 34, 8 * sizeof(float) );	// wBitsPerSample
+	memcpy( h + 36, "data", 4 );
+	write_uint32_le( h + 40, data_bytes );			// Data chunk size
+
+	return fseek( file, 0, SEEK_SET ) == 0 && fwrite( h, 1, sizeof(h), file ) == sizeof(h);
+}
+
+/**
+ * Thread of the sinks that take frames as soon as they are ready. Once
+ * stopped it takes whatever is left before returning, so a file gets
+ * every frame the player rendered.
+ **/
+static void xm_host_drain( xm_host_t* host ){
+	float frames[ XM_HOST_CHUNK * 2 ];
+
+	for (;;){
+		// Read before consuming, so nothing rendered before the stop is missed
+		bool stopping = !host->running.load();
+		uint16_t n = host->consume( frames, XM_HOST_CHUNK, false );
+
+		if (!n){
+			if (stopping) break;
+			std::this_thread::yield();
+			continue;
+		}
+		if (host->file){
+			// Floats are written as they are, so this assumes a little endian host
+			host->data_bytes += fwrite( frames, 2 * sizeof(float), n, host->file ) * 2 * sizeof(float);
+		}
+		host->frames.fetch_add( n );
+	}
+}
+
+/**
+ * Thread of the paced sink. Periods are counted from the start, so a late
+ * wake up takes more frames rather than drifting.
+ **/
+static void xm_host_pace( xm_host_t* host, uint32_t rate ){
+	float frames[ XM_HOST_CHUNK * 2 ];
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	uint64_t due = 0;
+
+	for (uint64_t period = 1; host->running.load(); period++){
+		std::this_thread::sleep_until( start + std::chrono::microseconds( period * host->period_us ) );
+		uint64_t elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - start ).count();
+		uint64_t target = elapsed * rate / 1000000;
+
+		while (due < target){
+			uint16_t n = (target - due > XM_HOST_CHUNK) ? XM_HOST_CHUNK : uint16_t(target - due);
+
+			host->consume( frames, n, true );
+			host->frames.fetch_add( n );
+			due += n;
+		}
+		period = elapsed / host->period_us;
+	}
+}
+
+static bool xm_host_start( xm_output_t* output, xm_output_consume_t consume ){
+	xm_host_t* host = (xm_host_t*)output->user;
+
+	if (host->running.load()) return false;
+	host->consume = consume;
+	host->running.store( true );
+	if (host->kind == XM_HOST_PACED){
+		host->thread = std::thread( xm_host_pace, host, output->rate );
+	}
+	else{
+		host->thread = std::thread( xm_host_drain, host );
+	}
+	return true;
+}
+
+static void xm_host_stop( xm_output_t* output ){
+	xm_host_t* host = (xm_host_t*)output->user;
+
+	if (!host->running.load()) return;
+	host->running.store( false );
+	host->thread.join();
+
+	// Keep the file playable after every stop
+	if (host->file){
+		xm_host_wav_header( host->file, output->rate, host->data_bytes );
+		fseek( host->file, 0, SEEK_END );
+		fflush( host->file );
+	}
+}
+
+static bool xm_host_create( xm_output_t* output, uint32_t rate, xm_host_kind_t kind ){
+	xm_host_t* host = new xm_host_t();
+
+	if (!host) return false;
+	host->kind = kind;
+	host->period_us = 0;
+	host->file = NULL;
+	host->data_bytes = 0;
+	host->running.store( false );
+	host->frames.store( 0 );
+	host->consume = NULL;
+
+	output->rate = rate;
+	output->start = xm_host_start;
+	output->stop = xm_host_stop;
+	output->user = host;
+	return true;
+}
+
+/**
+ * A null sink at 48kHz, so the player runs on a PC without choosing an
+ * output. Statics start zeroed, which makes it XM_HOST_NULL and stopped.
+ **/
+static xm_host_t _default_host;
+static xm_output_t _default = { 48000, xm_host_start, xm_host_stop, &_default_host };
+xm_output_t* const xm_output_default = &_default;
+
+bool xm_output_null( xm_output_t* output, uint32_t rate ){
+	return xm_host_create( output, rate, XM_HOST_NULL );
+}
+
+bool xm_output_wav( xm_output_t* output, uint32_t rate, const char* filename ){
+	FILE* file = fopen( filename, "wb" );
+
+	if (!file) return false;
+	if (!xm_host_wav_header( file, rate, 0 ) || !xm_host_create( output, rate, XM_HOST_WAV )){
+		fclose( file );
+		return false;
+	}
+	((xm_host_t*)output->user)->file = file;
+	return true;
+}
+
+bool xm_output_paced( xm_output_t* output, uint32_t rate, uint32_t period_us ){
+	if (!period_us || !xm_host_create( output, rate, XM_HOST_PACED )) return false;
+	((xm_host_t*)output->user)->period_us = period_us;
+	return true;
+}
+
+uint64_t xm_output_frames( const xm_output_t* output ){
+	return ((const xm_host_t*)output->user)->frames.load();
+}
+
+void xm_output_free( xm_output_t* output ){
+	xm_host_t* host = (xm_host_t*)output->user;
+
+	if (!host) return;
+	xm_host_stop( output );
+	if (host->file) fclose( host->file );
+	delete host;
+	output->user = NULL;
+}
+
+#endif
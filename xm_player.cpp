@@ -0,0 +1,650 @@
+/* Author: Peter "Projectitis" Vullings <peter@projectitis.com> */
+/* Website: https://github.com/Artefact2/libxm */
+
+/* This program is free software. It comes without any warranty, to the
+ * extent permitted by applicable law. You can redistribute it and/or
+ * modify it under the terms of the Do What The Fuck You Want To Public
+ * License, Version 2, as published by Sam Hocevar. See
+ * http://sam.zoy.org/wtfpl/COPYING for more details. */
+
+#include "xm_player.h"
+
+extern "C" {
+	#include "xm_internal.h"
+}
+
+/**
+ * A module the player plays
+ **/
+typedef struct {
+	xm_context_t* context;
+	bool xmized;			// Created from libxmized data
+	float gain;
+	float target;			// Gain being faded to
+	float step;				// Change of gain per frame while fading, or 0
+} xm_player_slot_t;
+
+/**
+ * The modules, mixed in this order
+ **/
+static xm_player_slot_t _slots[ XM_PLAYER_CONTEXTS ];
+
+/**
+ * The backend playing from the ring
+ **/
+static xm_output_t* _output = NULL;
+
+/**
+ * Flag indicated state of player
+ **/
+static bool _started = false;
+
+/**
+ * Ring buffer for sample pairs. xm_player_update() fills it and the
+ * output drains it, see xm_ring.h
+ **/
+static xm_ring_t _ring;
+
+/**
+ * Buffer settings, see xm_player_buffer(). 0 frames is the default depth.
+ **/
+static uint16_t _frames = 0;
+static uint16_t _threshold = 1;
+static uint16_t _chunk = 0;
+
+/**
+ * Telemetry, see xm_player_stats(). The ring counts underruns as they
+ * happen, and the stats report them from _underruns_base.
+ **/
+static xm_player_stats_t _stats;
+static uint32_t _underruns_base = 0;
+static uint32_t _last_update = 0;
+
+/**
+ * Quality governor, see xm_player_governor()
+ **/
+static bool _governed = false;
+static uint8_t _low_fill = 25;
+static uint8_t _max_load = 70;
+static uint8_t _level = 0;
+static uint32_t _since_change = 0;		// Frames rendered since the level changed
+static uint32_t _calm = 0;				// Frames rendered with headroom in a row
+
+/**
+ * The output in use
+ **/
+static xm_output_t* xm_player_current_output( void ){
+	if (!_output) _output = xm_output_default;
+	return _output;
+}
+
+/**
+ * Frames the ring is created for
+ **/
+static uint16_t xm_player_frames( void ){
+	if (_frames) return _frames;
+	return uint16_t(xm_player_current_output()->rate / 480);	// Number of sample pairs (L+R)
+}
+
+/**
+ * Create the ring buffer
+ **/
+static bool xm_player_create_buffer( void ){
+	xm_underrun_t underrun = _ring.underrun;
+	bool ok;
+
+	xm_ring_free( &_ring );
+	ok = xm_ring_init( &_ring, xm_player_frames() );
+	_ring.underrun = underrun;
+	xm_player_reset_stats();
+	return ok;
+}
+
+/**
+ * True if any slot has a module
+ **/
+static bool xm_player_loaded( void ){
+	for (uint8_t i = 0; i < XM_PLAYER_CONTEXTS; i++){
+		if (_slots[i].context) return true;
+	}
+	return false;
+}
+
+/**
+ * Set the quality of a module for the level of the governor
+ **/
+static void xm_player_apply_level( xm_context_t* context ){
+	uint8_t quality = XM_QUALITY_ALL;
+	uint8_t channels = 0;
+
+	if (_level >= 1) quality &= ~XM_QUALITY_INTERPOLATION;
+	if (_level >= 2) quality &= ~XM_QUALITY_RAMPING;
+	if (_level >= 3){
+		// 3/4 of the channels at level 3, down to 1/4 at level 5
+		channels = uint8_t( XM_MIXED_CHANNELS( context ) * (XM_PLAYER_LEVELS - _level) / 4 );
+		if (!channels) channels = 1;
+	}
+	xm_set_quality( context, quality );
+	xm_set_max_mixed_channels( context, channels );
+}
+
+/**
+ * Move the governor to a level and set every module loaded to it
+ **/
+static void xm_player_set_level( uint8_t level ){
+	if (level != _level) _stats.level_changes++;
+	_level = level;
+	_since_change = 0;
+	_calm = 0;
+	for (uint8_t i = 0; i < XM_PLAYER_CONTEXTS; i++){
+		if (_slots[i].context) xm_player_apply_level( _slots[i].context );
+	}
+	if (level > _stats.max_level) _stats.max_level = level;
+}
+
+/**
+ * Put a new context in an empty slot, and create the buffer for the
+ * first one
+ **/
+static void xm_player_fill_slot( uint8_t slot, xm_context_t* context, bool xmized ){
+	if (_governed) xm_player_apply_level( context );
+	_slots[slot].context = context;
+	_slots[slot].xmized = xmized;
+	_slots[slot].gain = _slots[slot].target = 1.0f;
+	_slots[slot].step = 0.0f;
+	if (!_ring.size) xm_player_create_buffer();
+}
+
+/**
+ * Handed to the output when it starts, see xm_output_consume_t
+ **/
+static uint16_t xm_player_consume( float* frames, uint16_t count, bool due ){
+	uint16_t n = xm_ring_read( &_ring, frames, count );
+
+	if (due && n < count){
+		xm_ring_underrun( &_ring, frames + n * 2, count - n );
+	}
+	return n;
+}
+
+/**
+ * Choose the output
+ * @param	output		The backend to play through
+ **/
+bool xm_player_output( xm_output_t* output ){
+	if (xm_player_loaded()) return false;
+	_output = output;
+	return true;
+}
+
+/**
+ * Set up the buffer
+ * @param	frames		Depth of the buffer in frames
+ * @param	threshold	Free frames needed before update renders
+ * @param	chunk		Most frames rendered at once, 0 for no limit
+ **/
+bool xm_player_buffer( uint16_t frames, uint16_t threshold, uint16_t chunk ){
+	if (_started || frames == 0 || frames == UINT16_MAX) return false;
+
+	_frames = frames;
+	_threshold = (threshold < 1) ? 1 : (threshold > frames) ? frames : threshold;
+	_chunk = chunk;
+	if (xm_player_loaded() && !xm_player_create_buffer()){
+		// Keep a buffer that works rather than none at all
+		_frames = 0;
+		_threshold = 1;
+		_chunk = 0;
+		xm_player_create_buffer();
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Latency of a full buffer in microseconds
+ **/
+uint32_t xm_player_latency( void ){
+	return uint32_t( uint64_t(xm_player_frames()) * 1000000 / xm_player_current_output()->rate );
+}
+
+/**
+ * Initialise the mod player
+ * @param	moddata		The mod data as a libxmized format (non-delta coded)
+ * @param	slot		The slot to play it in
+ **/
+void xm_player_xmize( const char* moddata, uint8_t slot ){
+	xm_context_t* context;
+
+	if (slot >= XM_PLAYER_CONTEXTS || _slots[slot].context) return;
+
+	// Create context
+	if (xm_create_shared_context_from_libxmize(
+		&context,
+		moddata,
+		xm_player_current_output()->rate
+	)){
+		xm_stdout("Module data is not a libxmized image made with these settings\n");
+		return;
+	}
+	xm_player_fill_slot( slot, context, true );
+}
+#ifdef XM_HAS_MMAP
+/**
+ * Initialise the mod player with a mapped .xm module or libxmized image.
+ * Unlike xm_player_xmize(), the image is checked against the length of
+ * the file before it is used.
+ * @param	map			The file mapped by xm_map_module(). It must stay
+ *						mapped while the slot plays
+ * @param	slot		The slot to load it into
+ **/
+void xm_player_mapped( const xm_mapped_module_t* map, uint8_t slot ){
+	xm_context_t* context;
+	const char* data;
+	size_t length;
+
+	if (slot >= XM_PLAYER_CONTEXTS || _slots[slot].context) return;
+
+	// Create context
+	if (xm_create_context_from_mapped(
+		&context,
+		map,
+		xm_player_current_output()->rate
+	)){
+		return;
+	}
+	data = xm_get_mapped_data( map, &length );
+	xm_player_fill_slot( slot, context, length < 17 || memcmp( data, "Extended Module: ", 17 ) != 0 );
+}
+#endif
+/**
+ * Initialise the mod player with a module of a bank, or switch to
+ * another module of it. The player keeps running, the new song starts
+ * with the next buffer.
+ * @param	bank		The bank made by xm_libxmize_bank()
+ * @param	index		The module in the bank, from 0
+ * @param	slot		The slot to play it in
+ **/
+void xm_player_bank( const char* bank, uint16_t index, uint8_t slot ){
+	xm_context_t* context;
+
+	if (slot >= XM_PLAYER_CONTEXTS) return;
+	if (_slots[slot].context && !_slots[slot].xmized) return;
+
+	// Create the new context before dropping the old one
+	if (xm_create_shared_context_from_bank(
+		&context,
+		bank,
+		index,
+		xm_player_current_output()->rate
+	)){
+		xm_stdout("Module is not in a bank made with these settings\n");
+		return;
+	}
+	if (_slots[slot].context){
+		context->amplification = _slots[slot].context->amplification;
+		if (_governed) xm_player_apply_level( context );
+		xm_free_context( _slots[slot].context );
+		_slots[slot].context = context;
+		return;
+	}
+	xm_player_fill_slot( slot, context, true );
+}
+void xm_player_xm( const char* moddata, uint32_t moddata_size, uint8_t slot ){
+	xm_context_t* context;
+
+	if (slot >= XM_PLAYER_CONTEXTS || _slots[slot].context) return;
+
+	// Create context
+	if (xm_create_context_safe(
+		&context,
+		moddata,
+		moddata_size,
+		xm_player_current_output()->rate
+	)){
+		return;
+	}
+	xm_player_fill_slot( slot, context, false );
+}
+
+/**
+ * Stop playing the module in a slot and free it
+ **/
+void xm_player_unload( uint8_t slot ){
+	if (slot >= XM_PLAYER_CONTEXTS || !_slots[slot].context) return;
+	xm_free_context( _slots[slot].context );
+	_slots[slot].context = NULL;
+}
+
+/**
+ * The context of the loaded module
+ **/
+xm_context_t* xm_player_context( uint8_t slot, bool* xmized ){
+	if (slot >= XM_PLAYER_CONTEXTS) return NULL;
+	if (xmized) *xmized = _slots[slot].xmized;
+	return _slots[slot].context;
+}
+
+/**
+ * Destructor
+ **/
+void xm_player_exit( void ){
+	// The output must not read the buffer once it is freed
+	if (_started) xm_player_stop();
+	for (uint8_t i = 0; i < XM_PLAYER_CONTEXTS; i++){
+		xm_player_unload( i );
+	}
+	xm_ring_free( &_ring );
+}
+
+/**
+ * Set global volume
+ **/
+void xm_player_volume( float vol, uint8_t slot ){
+	if (slot >= XM_PLAYER_CONTEXTS || !_slots[slot].context) return;
+	_slots[slot].context->amplification = vol;
+}
+
+/**
+ * Set or fade the gain of a slot
+ * @param	slot		The slot
+ * @param	gain		Gain to set or fade to
+ * @param	fade_ms		Time to fade over, 0 to set it at once
+ **/
+void xm_player_gain( uint8_t slot, float gain, uint32_t fade_ms ){
+	xm_player_slot_t* s;
+	uint32_t frames;
+
+	if (slot >= XM_PLAYER_CONTEXTS || !_slots[slot].context) return;
+	s = _slots + slot;
+	frames = uint32_t( uint64_t(fade_ms) * xm_player_current_output()->rate / 1000 );
+	s->target = gain;
+	if (frames){
+		s->step = (gain - s->gain) / frames;
+	}
+	else{
+		s->gain = gain;
+		s->step = 0.0f;
+	}
+}
+
+#ifdef XM_SFX_VOICES
+/**
+ * Play a sound effect over the module in a slot
+ * @return		the voice, or -1 if none could be used
+ **/
+int8_t xm_player_sfx( uint16_t instrument, uint8_t note, float volume, float panning, uint8_t priority, uint8_t slot ){
+	if (slot >= XM_PLAYER_CONTEXTS || !_slots[slot].context) return -1;
+	return xm_trigger_voice( _slots[slot].context, instrument, note, volume, panning, priority );
+}
+
+/**
+ * Release the key of a sound effect
+ **/
+void xm_player_sfx_release( int8_t voice, uint8_t slot ){
+	if (slot >= XM_PLAYER_CONTEXTS || !_slots[slot].context) return;
+	xm_release_voice( _slots[slot].context, voice );
+}
+#endif
+
+/**
+ * Set what the output does when xm_player_update() has not kept up
+ **/
+void xm_player_underrun( xm_underrun_t policy ){
+	_ring.underrun = policy;
+}
+
+/**
+ * Start or unpause the player
+ * @param	frombeginning		If true, will start again from the
+ *								beginning. If false, will continue
+ *								from last stop()
+ */
+void xm_player_start( bool frombeginning ){
+	if (!xm_player_loaded()) return;
+
+	if (frombeginning){
+		for (uint8_t i = 0; i < XM_PLAYER_CONTEXTS; i++){
+			if (_slots[i].context) xm_reset( _slots[i].context );
+		}
+	}
+	if (!_started){
+		_started = _output->start( _output, xm_player_consume );
+	}
+}
+
+/**
+ * Stop or pause the player and discontinue audio output
+ **/
+void xm_player_stop( void ){
+	if (_started) _output->stop( _output );
+	_started = false;
+}
+
+/**
+ * Read the stats
+ **/
+void xm_player_stats( xm_player_stats_t* stats ){
+	*stats = _stats;
+	stats->underruns = _ring.underruns.load( std::memory_order_relaxed ) - _underruns_base;
+	stats->level = _level;
+}
+
+/**
+ * Start counting again
+ **/
+void xm_player_reset_stats( void ){
+	memset( &_stats, 0, sizeof(_stats) );
+	_stats.min_fill = xm_ring_capacity( &_ring );
+	_stats.max_level = _level;
+	_underruns_base = _ring.underruns.load( std::memory_order_relaxed );
+}
+
+/**
+ * Count the time since the last update in the histogram
+ **/
+static void xm_player_count_gap( uint32_t gap ){
+	uint8_t bucket = 0;
+
+	for (uint32_t n = gap / 250; n && bucket < XM_PLAYER_GAP_BUCKETS - 1; n >>= 1){
+		bucket++;
+	}
+	_stats.gaps[ bucket ]++;
+	if (gap > _stats.max_gap) _stats.max_gap = gap;
+}
+
+/**
+ * Move the gain of a slot on by frames while it fades
+ **/
+static void xm_player_fade( xm_player_slot_t* slot, uint16_t frames ){
+	if (slot->step == 0.0f) return;
+	slot->gain += slot->step * frames;
+	if ((slot->step > 0.0f) ? slot->gain >= slot->target : slot->gain <= slot->target){
+		slot->gain = slot->target;
+		slot->step = 0.0f;
+	}
+}
+
+/**
+ * Mix all modules into count frames at dst, in one pass over the frames
+ * for each module. Gains change every XM_PLAYER_FADE_FRAMES frames while
+ * a slot fades.
+ **/
+static void xm_player_render( float* dst, uint16_t count ){
+	while (count){
+		uint16_t n = count;
+		bool mixed = false;
+
+		for (uint8_t i = 0; i < XM_PLAYER_CONTEXTS; i++){
+			if (_slots[i].step != 0.0f && n > XM_PLAYER_FADE_FRAMES) n = XM_PLAYER_FADE_FRAMES;
+		}
+		for (uint8_t i = 0; i < XM_PLAYER_CONTEXTS; i++){
+			xm_player_slot_t* slot = _slots + i;
+
+			if (!slot->context) continue;
+
+			// The first module writes the frames, the others add to them
+			if (!mixed && slot->gain == 1.0f){
+				xm_generate_samples( slot->context, dst, n );
+			}
+			else{
+				if (!mixed) memset( dst, 0, n * 2 * sizeof(float) );
+				xm_mix_samples( slot->context, dst, n, slot->gain );
+			}
+			mixed = true;
+			xm_player_fade( slot, n );
+		}
+		if (!mixed) memset( dst, 0, n * 2 * sizeof(float) );
+		dst += n * 2;
+		count -= n;
+	}
+}
+
+/**
+ * Move the governor after an update rendered frames
+ * @param	fill		Frames that were buffered when the update was called
+ * @param	frames		Frames it rendered
+ * @param	time		Time it took, in microseconds
+ **/
+static void xm_player_govern( uint16_t fill, uint16_t frames, uint32_t time ){
+	uint32_t capacity = xm_ring_capacity( &_ring );
+	// Updates only render once threshold frames are free, so this is the
+	// most they can find in the buffer, and fill is measured against it
+	uint32_t reach = (capacity > _threshold) ? capacity - _threshold : 0;
+	uint32_t rate = xm_player_current_output()->rate;
+	// Time spent rendering, as a percentage of the time the frames play for
+	uint32_t load = uint32_t( uint64_t(time) * rate * 100 / (uint64_t(frames) * 1000000) );
+	// Fill to raise above: twice low_fill, but no more than halfway from
+	// it to the most an update can find
+	uint32_t high_fill = (_low_fill * 2 < (_low_fill + 100) / 2) ? _low_fill * 2 : (_low_fill + 100) / 2;
+
+	if (_since_change < capacity) _since_change += frames;
+
+	if (fill * 100 < reach * _low_fill || load > _max_load){
+		_calm = 0;
+		// Lower once the last change has had time to show
+		if (_level < XM_PLAYER_LEVELS - 1 && _since_change >= capacity){
+			xm_player_set_level( _level + 1 );
+		}
+	}
+	else if (fill * 100 >= reach * high_fill && load * 2 < _max_load){
+		_calm += frames;
+		if (_level && _calm >= rate * XM_PLAYER_GOVERNOR_HOLD_MS / 1000){
+			xm_player_set_level( _level - 1 );
+		}
+	}
+	else{
+		_calm = 0;
+	}
+}
+
+/**
+ * Render into the space the output has freed, up to a budget
+ * @param	max_frames	Most frames to render, 0 for no limit
+ * @param	max_us		Time to stop rendering after, 0 for no limit. It is
+ *						checked every XM_PLAYER_SLICE_FRAMES frames
+ * @return		number of sample pairs pushed to the ringbuffer
+ **/
+static uint16_t xm_player_fill( uint16_t max_frames, uint32_t max_us ){
+	uint16_t numpairs = 0;
+	uint16_t count;
+	float* dst;
+	uint32_t now;
+	uint16_t fill;
+
+	if (!xm_player_loaded()) return 0;
+
+	now = xm_micros();
+	if (_stats.updates) xm_player_count_gap( now - _last_update );
+	_last_update = now;
+	_stats.updates++;
+
+	// The buffer starts out empty, so only count it once it has been filled
+	fill = xm_ring_fill( &_ring );
+	if (_stats.renders && fill < _stats.min_fill) _stats.min_fill = fill;
+	if (xm_ring_capacity( &_ring ) - fill < _threshold){
+		_stats.overruns++;
+		return 0;
+	}
+
+	// Fill whatever space the output has freed. It may wrap around the
+	// end of the ring, so this takes two goes if it does, and more if
+	// chunks or slices are smaller than that. The mixer keeps its place
+	// between frames, so the next call carries on where a budget stopped.
+	while ((dst = xm_ring_write_begin( &_ring, &count )) && count){
+		if (max_frames){
+			if (numpairs >= max_frames) break;
+			if (count > max_frames - numpairs) count = max_frames - numpairs;
+		}
+		if (_chunk && count > _chunk) count = _chunk;
+		if (max_us){
+			if (numpairs && xm_micros() - now >= max_us) break;
+			if (count > XM_PLAYER_SLICE_FRAMES) count = XM_PLAYER_SLICE_FRAMES;
+		}
+		xm_player_render( dst, count );
+		xm_ring_write_end( &_ring, count );
+		numpairs += count;
+	}
+	if (dst && count) _stats.yields++;
+
+	if (numpairs){
+		uint32_t time = xm_micros() - now;
+
+		// Only once the buffer has been filled, like min_fill
+		if (_governed && _stats.renders) xm_player_govern( fill, numpairs, time );
+		_stats.renders++;
+		_stats.render_time += time;
+		if (time > _stats.max_render) _stats.max_render = time;
+	}
+	return numpairs;
+}
+
+/**
+ * Called during the update loop to step the player. This is typically done
+ * even while the player is stopped, though it is safe not to call update
+ * if the player is stopped.
+ */
+uint16_t xm_player_update( void ){
+	return xm_player_fill( 0, 0 );
+}
+
+/**
+ * Step the player without taking more than a budget of the update loop
+ **/
+uint16_t xm_player_update_budget( uint16_t max_frames, uint32_t max_us ){
+	return xm_player_fill( max_frames, max_us );
+}
+
+/**
+ * Jump to a specific location in the file, in time with the music
+ * @param	location	Position in the pattern order table to jump to
+ * @param	when		Boundary to jump at, XM_JUMP_PATTERN, _BEAT or _ROW
+ * @param	fade		Stop the notes of the current part at the jump
+ * @param	slot		Slot of the module
+ **/
+bool xm_player_jump( uint8_t location, int when, bool fade, uint8_t slot ){
+	if (slot >= XM_PLAYER_CONTEXTS || !_slots[slot].context) return false;
+	return xm_schedule_jump( _slots[slot].context, location, 0, (uint8_t)when, fade );
+}
+
+/**
+ * Jump in slot 0 as the earlier xm_player_jump( location, wait ) did
+ * @param	location	Position in the pattern order table to jump to
+ * @param	wait		Wait for the current pattern to end rather than
+ *						jumping on the next row
+ **/
+bool xm_player_jump( uint8_t location, bool wait ){
+	return xm_player_jump( location, wait ? XM_JUMP_PATTERN : XM_JUMP_ROW );
+}
+
+/**
+ * Turn the quality governor on or off
+ * @param	on			Whether to govern
+ * @param	low_fill	Percentage of the buffer to keep filled, below 100
+ * @param	max_load	Percentage of real time rendering may take
+ **/
+void xm_player_governor( bool on, uint8_t low_fill, uint8_t max_load ){
+	_low_fill = (low_fill < 100) ? low_fill : 99;
+	_max_load = max_load;
+	_governed = on;
+	xm_player_set_level( 0 );
+}
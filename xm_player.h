@@ -0,0 +1,317 @@
+/* Author: Peter "Projectitis" Vullings <peter@projectitis.com> */
+
+/* This program is free software. It comes without any warranty, to the
+ * extent permitted by applicable law. You can redistribute it and/or
+ * modify it under the terms of the Do What The Fuck You Want To Public
+ * License, Version 2, as published by Sam Hocevar. See
+ * http://sam.zoy.org/wtfpl/COPYING for more details. */
+
+/**
+ * The mod player. It renders into a ring (xm_ring.h) that an output
+ * backend (xm_output.h) plays from, and has no Arduino dependencies, so
+ * it builds on a PC with one of the host backends as well. On a Teensy
+ * include xm_t3.h, which adds the DAC backend and saving to SD.
+ **/
+
+#ifndef __has_xm_player_h_
+#define __has_xm_player_h_
+
+extern "C" {
+	#include "xm.h"
+}
+#include "xm_ring.h"
+#include "xm_output.h"
+
+/**
+ * Modules the player can play at once, each in its own slot. Each module
+ * loaded costs as much to render as playing it alone.
+ **/
+#ifndef XM_PLAYER_CONTEXTS
+	#define XM_PLAYER_CONTEXTS	2
+#endif
+
+/**
+ * While a slot fades, its gain changes every this many frames
+ **/
+#define XM_PLAYER_FADE_FRAMES	32
+
+/**
+ * Choose the output the player plays through. Call it before loading a
+ * module, as the module is loaded for the rate of the output. Without it
+ * the player uses xm_output_default.
+ * @return		false if the player has a module loaded
+ **/
+bool xm_player_output( xm_output_t* output );
+
+/**
+ * Set up the buffer between the player and the output. Deeper buffers
+ * ride out longer gaps between calls to xm_player_update(), at the cost
+ * of latency: volume changes and song switches are heard that much later.
+ * The default is rate / 480 frames (2ms at 48kHz) and is used until this
+ * is called. Buffered frames are dropped.
+ * @param	frames		Frames the buffer holds, at most 65534
+ * @param	threshold	xm_player_update() renders nothing until at least
+ *						this many frames are free, so it renders fewer,
+ *						bigger blocks. Clamped to 1..frames
+ * @param	chunk		Most frames rendered per call to the mixer, 0 for
+ *						no limit. Smaller chunks are handed to the output
+ *						sooner while a big gap is being filled
+ * @return		false if the player is running, or frames is out of range
+ *				or does not fit in memory
+ **/
+bool xm_player_buffer( uint16_t frames, uint16_t threshold = 1, uint16_t chunk = 0 );
+
+/**
+ * Time from a frame being rendered to it being output when the buffer is
+ * full, which is the most it can be, in microseconds. It does not include
+ * any latency of the output itself.
+ **/
+uint32_t xm_player_latency( void );
+
+/**
+ * Initialise the mod player
+ * Still need to call start after this to start actual playback.
+ * Modules can be loaded into other slots while the player runs, to play
+ * over the first one (ambience over music, or the next song to
+ * crossfade to), and are mixed in the order of their slots.
+ * @param	moddata		The mod data as a libxmized format (non-delta coded)
+ * @param	slot		Which of the XM_PLAYER_CONTEXTS slots to load it
+ *						into. Nothing happens if the slot is in use
+ **/
+void xm_player_xmize( const char* moddata, uint8_t slot = 0 );
+void xm_player_xm( const char* moddata, uint32_t moddata_size, uint8_t slot = 0 );
+#ifdef XM_HAS_MMAP
+/**
+ * Initialise the mod player with a file mapped by xm_map_module(), either
+ * a .xm module or a libxmized image, which is checked before it is used.
+ * The file must stay mapped while the slot plays.
+ **/
+void xm_player_mapped( const xm_mapped_module_t* map, uint8_t slot = 0 );
+#endif
+
+/**
+ * Initialise the mod player with module index (from 0) of a bank made by
+ * xm_libxmize_bank(), or switch the running player to another module
+ * of the same or another bank without stopping it.
+ **/
+void xm_player_bank( const char* bank, uint16_t index, uint8_t slot = 0 );
+
+/**
+ * Stop playing the module in a slot and free it. The other slots play on.
+ **/
+void xm_player_unload( uint8_t slot );
+
+/**
+ * The context of the module in a slot, or NULL
+ * @param	xmized		If not NULL, receives true if the module was loaded
+ *						from libxmized data, which is not libxmized again
+ **/
+xm_context_t* xm_player_context( uint8_t slot = 0, bool* xmized = NULL );
+
+/**
+ * Set global volume
+ **/
+void xm_player_volume( float vol, uint8_t slot = 0 );
+
+/**
+ * Set the gain a slot is mixed with, 1 when a module is loaded. A slot
+ * faded to 0 still costs as much to render; unload it once it is silent.
+ * @param	slot		The slot
+ * @param	gain		Gain to set, or to fade to
+ * @param	fade_ms		Time to fade over, 0 to set it at once. Fading one
+ *						slot down while another fades up crossfades them
+ **/
+void xm_player_gain( uint8_t slot, float gain, uint32_t fade_ms = 0 );
+
+#ifdef XM_SFX_VOICES
+/**
+ * Play a sound effect on one of the XM_SFX_VOICES voices of a slot, using
+ * an instrument of the module loaded there, see xm_trigger_voice(). It is
+ * heard once the frames already buffered have played, so keep the buffer
+ * shallow (xm_player_latency()) for effects that must be in time.
+ * @param	instrument	Instrument number, from 1
+ * @param	note		Note number, 49 is C-4
+ * @param	volume		Multiplier of the sample's volume
+ * @param	panning		0 (left) to 1 (right), or negative for the sample's
+ * @param	priority	Voices playing a higher priority are not taken
+ * @param	slot		Slot of the module
+ * @return		the voice, or -1 if none could be used
+ **/
+int8_t xm_player_sfx( uint16_t instrument, uint8_t note, float volume = 1.0f, float panning = 0.5f,
+	uint8_t priority = 0, uint8_t slot = 0 );
+
+/**
+ * Release the key of a sound effect started by xm_player_sfx(), for
+ * sustained instruments
+ **/
+void xm_player_sfx_release( int8_t voice, uint8_t slot = 0 );
+#endif
+
+/**
+ * Free the mod player (destructor equivalent)
+ **/
+void xm_player_exit( void );
+
+/**
+ * Start or unpause the player
+ * @param	frombeginning		If true, will start again from the
+ *								beginning. If false, will continue
+ *								from last stop(). Every loaded module
+ *								is reset with xm_reset(), which does
+ *								not load it again
+ */
+void xm_player_start( bool frombeginning = false );
+
+/**
+ * Stop or pause the player and discontinue audio output
+ **/
+void xm_player_stop( void );
+
+/**
+ * Set what is output when xm_player_update() is not called often enough
+ * and the buffer runs empty. The default, XM_UNDERRUN_HOLD, repeats the
+ * last sample pair, which is quieter than dropping to silence.
+ **/
+void xm_player_underrun( xm_underrun_t policy );
+
+/**
+ * Buckets of the histogram of time between updates. Bucket i counts gaps
+ * shorter than 250 << i microseconds (and at least the bucket before),
+ * the last one everything longer.
+ **/
+#define XM_PLAYER_GAP_BUCKETS 8
+
+/**
+ * How well xm_player_update() keeps up, since the module was loaded or
+ * the stats were reset. Times are in microseconds.
+ **/
+typedef struct {
+	uint32_t underruns;		// Frames the output needed before they were rendered
+	uint16_t min_fill;		// Fewest frames buffered when an update was called,
+							// after the first that rendered
+	uint32_t updates;		// Calls to xm_player_update()
+	uint32_t renders;		// Calls that rendered frames
+	uint32_t overruns;		// Calls that found too little space to render
+	uint32_t yields;		// Calls that used up their budget with space left,
+							// see xm_player_update_budget()
+	uint32_t gaps[XM_PLAYER_GAP_BUCKETS];	// Time between calls
+	uint32_t max_gap;		// Longest time between calls
+	uint32_t render_time;	// Time spent rendering, in all calls
+	uint32_t max_render;	// Longest time rendering in one call
+	uint8_t level;			// Quality level, see xm_player_governor()
+	uint8_t max_level;		// Lowest quality (highest level) played at
+	uint32_t level_changes;	// Times the governor changed the level
+} xm_player_stats_t;
+
+/**
+ * Read the stats. Safe while the player runs.
+ **/
+void xm_player_stats( xm_player_stats_t* stats );
+
+/**
+ * Start counting again from zero
+ **/
+void xm_player_reset_stats( void );
+
+/**
+ * Called during the update loop to step the player. This is typically done
+ * even while the player is stopped, though it is safe not to call update
+ * if you know the player is stopped.
+ * @return		number of sample pairs pushed to the ringbuffer
+ */
+uint16_t xm_player_update( void );
+
+/**
+ * While a slot is given a time budget, rendering stops to check the time
+ * after every this many frames
+ **/
+#define XM_PLAYER_SLICE_FRAMES	32
+
+/**
+ * Like xm_player_update(), but renders no more than a budget, so that
+ * rendering can be spread over several turns of a loop that also draws
+ * the display and reads input. The next call carries on at the frame
+ * this one stopped at, so the output is the same as with
+ * xm_player_update(), as long as the buffer does not run empty.
+ * @param	max_frames	Most frames to render, 0 for no limit
+ * @param	max_us		Stop once this many microseconds have been spent,
+ *						0 for no limit. The time is checked every
+ *						XM_PLAYER_SLICE_FRAMES frames, so a call can take
+ *						longer by the time to render that many frames
+ *						(more if a row starts many notes in them)
+ * @return		number of sample pairs pushed to the ringbuffer
+ **/
+uint16_t xm_player_update_budget( uint16_t max_frames, uint32_t max_us );
+
+/**
+ * Quality levels of the governor. Each level gives up more than the one
+ * before, see xm_set_quality() and xm_set_max_mixed_channels():
+ *   0		everything compiled in
+ *   1		no interpolation
+ *   2		no interpolation or ramping
+ *   3-5	as 2, and mix only 3/4, 1/2, then 1/4 of the channels of each
+ *			module, dropping the quietest
+ **/
+#define XM_PLAYER_LEVELS	6
+
+/**
+ * The governor only raises the quality once this long has been rendered
+ * with headroom, so it does not swing back and forth
+ **/
+#define XM_PLAYER_GOVERNOR_HOLD_MS	500
+
+/**
+ * Lower the quality of the modules rather than let the buffer run empty
+ * when rendering cannot keep up, and raise it again once it can. Each
+ * update that renders checks the buffer fill and the time rendering took
+ * against the time the frames play for, and moves one level at a time.
+ * After lowering, it waits for a buffer's worth of frames to see what
+ * that did before lowering again. While it is on, it sets the quality of
+ * every module loaded, overriding xm_set_quality() and
+ * xm_set_max_mixed_channels(). Turning it off goes back to level 0.
+ * Fill is counted as a percentage of the most an update that renders can
+ * find, the buffer less the threshold given to xm_player_buffer(), so a
+ * high threshold leaves the governor room to raise the quality again.
+ * @param	on			Whether to govern
+ * @param	low_fill	Lower the quality when an update finds less than
+ *						this percentage filled, up to 99
+ * @param	max_load	Lower the quality when rendering takes more than
+ *						this percentage of the time the frames play for.
+ *						It is raised again below half of this, with the
+ *						buffer over twice low_fill, or over halfway from
+ *						low_fill to full if that is less
+ **/
+void xm_player_governor( bool on, uint8_t low_fill = 25, uint8_t max_load = 70 );
+
+/**
+ * Jump to a specific location in the file.
+ *
+ * This is intended to change music mid-game depending on what is happening.
+ * Recommended to have un-reachable parts of the song that the player can
+ * jump to for different areas of the game. The jump is made in time with
+ * the music, see xm_schedule_jump(), and heard once the frames already
+ * buffered have played.
+ *
+ * @param	location	Position in the pattern order table to jump to
+ * @param	when		XM_JUMP_PATTERN to wait for the current pattern to
+ *						end, XM_JUMP_BEAT for the next beat or XM_JUMP_ROW
+ *						for the next row
+ * @param	fade		If true, notes of the current part stop at the jump
+ *						rather than ringing on into the new one
+ * @param	slot		Slot of the module
+ * @return		false if no module is loaded in the slot or location is
+ *				past the end of the song
+ */
+bool xm_player_jump( uint8_t location, int when = XM_JUMP_PATTERN, bool fade = false, uint8_t slot = 0 );
+
+/**
+ * The earlier form of xm_player_jump(), which took whether to wait for the
+ * current pattern to end. Calls passing true or false still mean that:
+ * true jumps at the end of the pattern (XM_JUMP_PATTERN), and false on
+ * the next row (XM_JUMP_ROW), as soon as the jump can be made in time.
+ * A bool would otherwise be taken as the XM_JUMP_* boundary, with true
+ * and false swapped.
+ **/
+bool xm_player_jump( uint8_t location, bool wait );
+
+#endif
@@ -0,0 +1,183 @@
+/* Author: Peter "Projectitis" Vullings <peter@projectitis.com> */
+
+/* This program is free software. It comes without any warranty, to the
+ * extent permitted by applicable law. You can redistribute it and/or
+ * modify it under the terms of the Do What The Fuck You Want To Public
+ * License, Version 2, as published by Sam Hocevar. See
+ * http://sam.zoy.org/wtfpl/COPYING for more details. */
+
+/**
+ * Lock-free single producer, single consumer ring of stereo frames.
+ *
+ * The player's update loop is the only producer and the output interrupt
+ * the only consumer. Each side only ever stores its own index, and
+ * publishes it with release ordering after touching the frames, so
+ * neither side needs to disable interrupts.
+ *
+ * One slot is always left empty to tell a full ring from an empty one,
+ * so a ring created for n frames has n + 1 slots.
+ *
+ * Nothing here depends on Arduino, so the ring builds on a PC as well.
+ **/
+
+#ifndef __has_xm_ring_h_
+#define __has_xm_ring_h_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+/**
+ * What the consumer outputs when the ring is empty
+ **/
+typedef enum {
+	XM_UNDERRUN_HOLD,		// Repeat the last frame, so the output does not jump
+	XM_UNDERRUN_SILENCE		// Output silence (0.0f)
+} xm_underrun_t;
+
+typedef struct {
+	float* frames;					// size stereo frames, left then right
+	uint16_t size;					// Slots, one more than the ring holds
+	std::atomic<uint16_t> head;		// Next slot to write, stored by the producer only
+	std::atomic<uint16_t> tail;		// Next slot to read, stored by the consumer only
+	xm_underrun_t underrun;
+	float last[2];					// Last frame read, for XM_UNDERRUN_HOLD
+	std::atomic<uint32_t> underruns;	// Frames that were due when the ring was empty
+} xm_ring_t;
+
+/**
+ * Allocate a ring holding up to frames stereo frames. Any frames in a
+ * ring that was in use are dropped.
+ * @return		false if out of memory or frames is 0 or too big
+ **/
+static inline bool xm_ring_init( xm_ring_t* ring, uint16_t frames ){
+	ring->frames = NULL;
+	ring->size = 0;
+	ring->head.store( 0, std::memory_order_relaxed );
+	ring->tail.store( 0, std::memory_order_relaxed );
+	ring->underrun = XM_UNDERRUN_HOLD;
+	ring->last[0] = ring->last[1] = 0.0f;
+	ring->underruns.store( 0, std::memory_order_relaxed );
+
+	if (frames == 0 || frames == UINT16_MAX) return false;
+	ring->frames = new float[ (frames + 1) * 2 ];
+	if (!ring->frames) return false;
+	ring->size = frames + 1;
+	return true;
+}
+
+/**
+ * Free the frames of a ring. The consumer must be stopped first.
+ **/
+static inline void xm_ring_free( xm_ring_t* ring ){
+	if (ring->frames) delete [] ring->frames;
+	ring->frames = NULL;
+	ring->size = 0;
+}
+
+/**
+ * Frames the ring can hold
+ **/
+static inline uint16_t xm_ring_capacity( const xm_ring_t* ring ){
+	return ring->size ? ring->size - 1 : 0;
+}
+
+/**
+ * Frames written and not read yet. Either side may call this; the other
+ * side can only make the answer more favourable to the caller.
+ **/
+static inline uint16_t xm_ring_fill( const xm_ring_t* ring ){
+	uint16_t head = ring->head.load( std::memory_order_acquire );
+	uint16_t tail = ring->tail.load( std::memory_order_acquire );
+
+	return (head >= tail) ? head - tail : ring->size - tail + head;
+}
+
+/**
+ * Frames that can be written before the ring is full
+ **/
+static inline uint16_t xm_ring_space( const xm_ring_t* ring ){
+	return xm_ring_capacity( ring ) - xm_ring_fill( ring );
+}
+
+/**
+ * Producer: find where to write next. The space may wrap around the end
+ * of the ring, so only the part up to the end is returned; write it,
+ * call xm_ring_write_end() and ask again for the rest.
+ * @param	frames		Receives the number of frames that can be written
+ *						at the returned address, 0 if the ring is full
+ * @return		the address to write left, right pairs to
+ **/
+static inline float* xm_ring_write_begin( xm_ring_t* ring, uint16_t* frames ){
+	uint16_t head = ring->head.load( std::memory_order_relaxed );
+	uint16_t tail = ring->tail.load( std::memory_order_acquire );
+	uint16_t end;
+
+	if (!ring->size){
+		*frames = 0;
+		return NULL;
+	}
+	if (tail > head){
+		end = tail - 1;						// Stop one short of the tail
+	}
+	else{
+		end = tail ? ring->size : ring->size - 1;	// To the end of the ring
+	}
+	*frames = end - head;
+	return ring->frames + head * 2;
+}
+
+/**
+ * Producer: publish frames written at the address from
+ * xm_ring_write_begin(). frames must not be more than it returned.
+ **/
+static inline void xm_ring_write_end( xm_ring_t* ring, uint16_t frames ){
+	uint16_t head = ring->head.load( std::memory_order_relaxed ) + frames;
+
+	if (head >= ring->size) head -= ring->size;
+	ring->head.store( head, std::memory_order_release );
+}
+
+/**
+ * Consumer: take up to count of the oldest frames.
+ * @return		the number of frames taken, fewer than count if the ring
+ *				ran empty
+ **/
+static inline uint16_t xm_ring_read( xm_ring_t* ring, float* frames, uint16_t count ){
+	uint16_t tail = ring->tail.load( std::memory_order_relaxed );
+	uint16_t head = ring->head.load( std::memory_order_acquire );
+	uint16_t n = 0;
+
+	while (n < count && tail != head){
+		frames[ n * 2 ] = ring->frames[ tail * 2 ];
+		frames[ n * 2 + 1 ] = ring->frames[ tail * 2 + 1 ];
+		if (++tail == ring->size) tail = 0;
+		n++;
+	}
+	if (n){
+		ring->last[0] = frames[ n * 2 - 2 ];
+		ring->last[1] = frames[ n * 2 - 1 ];
+		ring->tail.store( tail, std::memory_order_release );
+	}
+	return n;
+}
+
+/**
+ * Consumer: fill count frames that were due but not in the ring with what
+ * the underrun policy says, and count them.
+ **/
+static inline void xm_ring_underrun( xm_ring_t* ring, float* frames, uint16_t count ){
+	for (uint16_t i = 0; i < count; i++){
+		if (ring->underrun == XM_UNDERRUN_SILENCE){
+			frames[ i * 2 ] = frames[ i * 2 + 1 ] = 0.0f;
+		}
+		else{
+			frames[ i * 2 ] = ring->last[0];
+			frames[ i * 2 + 1 ] = ring->last[1];
+		}
+	}
+	// Only the consumer counts, so this needs no read-modify-write
+	ring->underruns.store( ring->underruns.load( std::memory_order_relaxed ) + count, std::memory_order_relaxed );
+}
+
+#endif
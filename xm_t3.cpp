@@ -24,117 +24,31 @@ void xm_delay( uint32_t ms ){
 	delay( ms );
 }
 
-/**
- * The context containing info about the mod
- **/
-static xm_context_t* _context = NULL;
-		
-/**
- * Interval timer for actual playback
- **/
-static IntervalTimer _timer;
-
-/**
- * Flag indicated state of player
- **/
-static bool _started = false;
-
-/**
- * Ring buffer for samples
- **/
-static float* _buffer;
-static uint16_t _bufferlen;	// sample pairs
-static uint16_t _buffersize;	// samples
-static uint16_t _bufferhead;	// index of head (writing)
-static volatile uint16_t _buffertail;	// index of tail (reading)
-static volatile uint16_t _bufferavail;	// available samples
-
-/**
- * Initialise the mod player
- * @param	moddata		The mod data as a libxmized format (non-delta coded)
- **/
-void xm_player_xmize( const char* moddata ){
-	if (_context) return;
-	
-	// Create context
-	xm_create_shared_context_from_libxmize(
-		&_context,
-		moddata,
-		XM_SAMPLE_RATE
-	);
-	// Create buffer
-	_bufferlen = uint16_t(XM_SAMPLE_RATE / 480);	// Number of sample pairs (L+R)
-	_buffersize = _bufferlen * 2;					// Size of buffer in samples
-	_buffer = new float[ _buffersize ];
-	_buffertail = 0;								// We read data from tail
-	_bufferhead = 0;								// We put data in from head (until we reach tail)
-	_bufferavail = 0;								// No samples data available yet
-	
-	// Set up pins
-	analogWriteResolution(12);
-	#ifdef XM_STEREO
-		pinMode ( XM_PIN_L, OUTPUT );
-		pinMode ( XM_PIN_R, OUTPUT );
-	#else
-		pinMode ( XM_PIN_L, OUTPUT );
-	#endif
-}
-void xm_player_xm( const char* moddata, uint32_t moddata_size ){
-	if (_context) return;
-	
-	// Create context
-	xm_create_context_safe(
-		&_context,
-		moddata,
-		moddata_size,
-		XM_SAMPLE_RATE
-	);
-	
-	// Create buffer
-	_bufferlen = uint16_t(XM_SAMPLE_RATE / 480);	// Number of sample pairs (L+R)
-	_buffersize = _bufferlen * 2;					// Size of buffer in samples
-	_buffer = new float[ _buffersize ];
-	_buffertail = 0;								// We read data from tail
-	_bufferhead = 0;								// We put data in from head (until we reach tail)
-	_bufferavail = 0;								// No samples data available yet
-	
-	// Set up pins
-	analogWriteResolution(12);
-	#ifdef XM_STEREO
-		pinMode ( XM_PIN_L, OUTPUT );
-		pinMode ( XM_PIN_R, OUTPUT );
-	#else
-		pinMode ( XM_PIN_L, OUTPUT );
-	#endif
+uint32_t xm_micros( void ){
+	return micros();
 }
 
 /**
- * Destructor
+ * Interval timer for actual playback
  **/
-void xm_player_exit( void ){
-	if (_context) xm_free_context( _context );
-	_context = NULL;
-	if (_buffer) delete [] _buffer;
-	_buffer = NULL;
-}
+static IntervalTimer _timer;
 
 /**
- * Set global volume
+ * Where the timer interrupt takes frames from, set on start
  **/
-void xm_player_volume( float vol ){
-	if (!_context) return;
-	_context->amplification = vol;
-}
+static xm_output_consume_t _consume = NULL;
 
 /**
  * Output sample on timer to produce the sound!
  **/
 static void xm_timer_interrupt( void ){
-	// XXX: Is this the correct way to handle empty buffer?
-	//if (!_bufferavail) return;
+	float frame[2];
+	
+	// An empty buffer gives the frame the underrun policy asks for
+	_consume( frame, 1, true );
 	
-	int16_t l_smp = 2048 + (_buffer[_buffertail++] * 2048.0f);
-	int16_t r_smp = 2048 + (_buffer[_buffertail++] * 2048.0f);
+	int16_t l_smp = 2048 + (frame[0] * 2048.0f);
+	int16_t r_smp = 2048 + (frame[1] * 2048.0f);
 	l_smp = (l_smp<0)?0:(l_smp>4095)?4095:l_smp; // Clamp to 12 bit range
 	r_smp = (r_smp<0)?0:(r_smp>4095)?4095:r_smp; // Clamp to 12 bit range
 	#ifdef XM_STEREO
@@ -143,34 +57,28 @@ static void xm_timer_interrupt( void ){
 	#else
 		analogWrite( XM_PIN_L, (l_smp+r_smp)/2.0f );
 	#endif
-
-	if (_buffertail >= _buffersize) _buffertail = 0;
-	_bufferavail -= 2;
 }
 
 /**
- * Start or unpause the player
- * @param	frombeginning		If true, will start again from the
- *								beginning. If false, will continue
- *								from last stop()
- */
-void xm_player_start( bool frombeginning ){
-	if (!_context) return;
+ * Set up the output pins and start the timer
+ **/
+static bool xm_dac_start( xm_output_t* output, xm_output_consume_t consume ){
+	analogWriteResolution(12);
+	#ifdef XM_STEREO
+		pinMode ( XM_PIN_L, OUTPUT );
+		pinMode ( XM_PIN_R, OUTPUT );
+	#else
+		pinMode ( XM_PIN_L, OUTPUT );
+	#endif
 	
-	if (frombeginning){
-		//xm_reset();
-	}
-	if (!_started){
-		_started = true;
-		_timer.begin( xm_timer_interrupt, 1000000.0f/XM_SAMPLE_RATE);
-	}
+	_consume = consume;
+	return _timer.begin( xm_timer_interrupt, 1000000.0f/output->rate );
 }
 
 /**
- * Stop or pause the player and discontinue audio output
+ * Stop the timer and discontinue audio output
  **/
-void xm_player_stop( void ){
-	_started = false;
+static void xm_dac_stop( xm_output_t* output ){
 	_timer.end();
 	analogWrite( XM_PIN_L, 0);
 	#ifdef XM_STEREO
@@ -178,49 +86,8 @@ void xm_player_stop( void ){
 	#endif
 }
 
-/**
- * Called during the update loop to step the player. This is typically done
- * even while the player is stopped, though it is safe not to call update
- * if the player is stopped.
- */
-uint16_t xm_player_update( void ){
-	// Check ringbuffer full
-	if (_bufferavail==_buffersize) return 0;
-	
-	uint16_t numpairs;
-	uint16_t numpairs2 = 0;
-	// Available space doesn't loop end of ring
-	if (_buffertail>_bufferhead){
-		numpairs = (_buffertail - _bufferhead) >> 1;
-		xm_generate_samples( _context, (float*)(_buffer+_bufferhead), numpairs);
-	}
-	else{
-		// Samples between head and end
-		numpairs = (_buffersize - _bufferhead) >> 1;
-		xm_generate_samples( _context, (float*)(_buffer+_bufferhead), numpairs);
-		// Samples between start and tail
-		numpairs2 = _buffertail >> 1;
-		xm_generate_samples( _context, _buffer, numpairs2);
-	}
-	_bufferhead = _buffertail;
-	_bufferavail = _buffersize;
-	return numpairs + numpairs2;
-}
-
-/**
- * Jump to a specific location in the file.
- *
- * This is intended to change music mid-game depending on what is happening.
- * Recommended to have un-reachable parts of the song that the player can
- * jump to for different areas of the game.
- * 
- * @param	location	Location to jump to
- * @param	wait		If true will wait for the current pattern to end
- *						first before jumping, otherwise will jump immediately
- */
-void xm_player_jump( uint8_t location, bool wait ){
-	
-}
+xm_output_t xm_output_dac = { XM_SAMPLE_RATE, xm_dac_start, xm_dac_stop, NULL };
+xm_output_t* const xm_output_default = &xm_output_dac;
 
 typedef union {
 	float f;
@@ -279,12 +146,22 @@ void write_uint16_le(uint16_t in, File file) {
 	#endif
 }
 
+/**
+ * Sink for xm_libxmize_context that writes to a file on the SD card
+ **/
+static bool write_file( void* user, const void* data, size_t length ){
+	return ((File*)user)->write( (const uint8_t*)data, length ) == length;
+}
+
 /**
  * Save to SD card. This is designed to work after loading a module
  * but before playing. If you have played or are playing the module
  * when this is called, the results are undefined!
  **/
 boolean xm_player_save( const char* filename, xm_savetype_t savetype ){
+	bool _xmized;
+	xm_context_t* _context = xm_player_context( 0, &_xmized );
+	
 	#if !defined(__MK64FX512__) && !defined(__MK66FX1M0__)
 		Serial.println(F("Save is currently supported on Teensy 3.5 and 3.6 only"));
 		return false;
@@ -295,12 +172,20 @@ boolean xm_player_save( const char* filename, xm_savetype_t savetype ){
 		return false;
 	}
 	
+	if (_xmized && (savetype == SAVETYPE_XMIZE || savetype == SAVETYPE_XMIZE_H)){
+		Serial.println(F("Module is already libxmized"));
+		return false;
+	}
+	
 	if (!SD.begin( BUILTIN_SDCARD )) {
 		Serial.println(F("SD initialization failed"));
 		return false;
 	}
 	
 	File outfile;
+	xm_header_writer_t header;
+	xm_libxmize_stats_t stats = {};
+	boolean ok = true;
 	float samplepair[2];
 	f_to_uint32_t sample;
 	uint32_t count;
@@ -445,10 +330,23 @@ boolean xm_player_save( const char* filename, xm_savetype_t savetype ){
 			}
 			break;
 		case SAVETYPE_XMIZE:
-			
+			// Raw binary image, for loading from SD or embedding with another tool
+			Serial.print(F("Writing libxmize file\n"));
+			ok = !xm_libxmize_context( _context, XM_TARGET_NATIVE, write_file, &outfile, &stats );
 			break;
 		case SAVETYPE_XMIZE_H:
-			
+			// Same image formatted as a header, ready to include in a sketch
+			Serial.print(F("Writing libxmize header file\n"));
+			#if defined(XM_ADPCM_SAMPLES)
+				outfile.print(F("// module data in libxmized format with ADPCM samples\n"));
+			#elif defined(XM_LIBXMIZE_DELTA_SAMPLES)
+				outfile.print(F("// module data in libxmized format with delta-encoded samples\n"));
+			#else
+				outfile.print(F("// module data in libxmized format without delta-encoded samples\n"));
+			#endif
+			ok = xm_header_begin( &header, "moddata", write_file, &outfile )
+				&& !xm_libxmize_context( _context, XM_TARGET_NATIVE, xm_header_write, &header, &stats )
+				&& xm_header_end( &header );
 			break;
 	}
 	
@@ -457,14 +355,23 @@ boolean xm_player_save( const char* filename, xm_savetype_t savetype ){
 	// close the file
     outfile.close();
 	
-	// Success
-	return true;
+	if (!ok){
+		Serial.printf(F("Writing %s failed\n"), filename);
+	}
+	else if (stats.saved_bytes){
+		Serial.printf(F("Saved %u bytes storing %u samples and %u patterns once\n"),
+			stats.saved_bytes, stats.shared_samples, stats.shared_patterns);
+	}
+	return ok;
 }
 
 /**
  * Dump information about the loaded module to serial.
  **/
 void xm_player_info( boolean verbose ){
+	xm_context_t* _context = xm_player_context();
+	
+	if (!_context) return;
 	Serial.println("### Dumping module information");
 	#ifdef XM_STRINGS
 		Serial.printf("  Module name:%s\n", _context->module->name );
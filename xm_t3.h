@@ -16,9 +16,7 @@
 #define __has_xm_t3_h_
 
 #include <Arduino.h>
-extern "C" {
-	#include "xm.h"
-}
+#include "xm_player.h"
 
 // Teensy 3.1 and 3.2 have only 1 DAC pin and will support mono output only
 #if defined(__MK20DX128__) || defined(__MK20DX128__)
@@ -35,43 +33,10 @@ extern "C" {
 #endif
 
 /**
- * Initialise the mod player
- * Still need to call start after this to start actual playback.
- * @param	moddata		The mod data as a libxmized format (non-delta coded)
+ * The DAC output, driven by an IntervalTimer at XM_SAMPLE_RATE. This is
+ * xm_output_default on a Teensy.
  **/
-void xm_player_xmize( const char* moddata );
-void xm_player_xm( const char* moddata, uint32_t moddata_size );
-
-/**
- * Set global volume
- **/
-void xm_player_volume( float vol );
-
-/**
- * Free the mod player (destructor equivalent)
- **/
-void xm_player_exit( void );
-
-/**
- * Start or unpause the player
- * @param	frombeginning		If true, will start again from the
- *								beginning. If false, will continue
- *								from last stop()
- */
-void xm_player_start( bool frombeginning = false );
-
-/**
- * Stop or pause the player and discontinue audio output
- **/
-void xm_player_stop( void );
-
-/**
- * Called during the update loop to step the player. This is typically done
- * even while the player is stopped, though it is safe not to call update
- * if you know the player is stopped.
- * @return		number of sample pairs pushed to the ringbuffer
- */
-uint16_t xm_player_update( void );
+extern xm_output_t xm_output_dac;
 
 /**
  * Type of file to save using xm_player_save
@@ -91,19 +56,6 @@ typedef enum {
  **/
 boolean xm_player_save( const char* filename, xm_savetype_t savetype );
 
-/**
- * Jump to a specific location in the file.
- *
- * This is intended to change music mid-game depending on what is happening.
- * Recommended to have un-reachable parts of the song that the player can
- * jump to for different areas of the game.
- * 
- * @param	location	Location to jump to
- * @param	wait		If true will wait for the current pattern to end
- *						first before jumping, otherwise will jump immediately
- */
-void xm_player_jump( uint8_t location, bool wait = true );
-
 /**
  * Dump information about the loaded module to serial.
  **/